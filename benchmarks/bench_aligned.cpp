@@ -0,0 +1,138 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// make_array() against make_array_aligned() for SIMD kernels and for
+// per-thread arrays placed next to each other. Rebuild with
+// -DARENA_PREFETCH_DISTANCE=256 to see the effect of write prefetching on
+// BM_Aligned_AllocateAndFill.
+
+namespace
+{
+  constexpr std::size_t kMaxThreads = 8;
+
+  // y = a * x + y; the compiler vectorizes this at -O2/-O3.
+  void saxpy(float a, const float *x, float *y, std::size_t n)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      y[i] = a * x[i] + y[i];
+  }
+
+  template <bool Aligned>
+  void run_saxpy(benchmark::State &state)
+  {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(4 * n * sizeof(float) + 1024);
+
+    // Knock the offset off any vector boundary, as earlier allocations would.
+    (void)a.allocate<1>(4);
+
+    float *x = nullptr;
+    float *y = nullptr;
+    if constexpr (Aligned)
+    {
+      x = a.make_array_aligned<float>(n);
+      y = a.make_array_aligned<float>(n);
+    }
+    else
+    {
+      x = a.make_array<float>(n);
+      y = a.make_array<float>(n);
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      x[i] = static_cast<float>(i);
+      y[i] = 1.0f;
+    }
+
+    for (auto _ : state)
+    {
+      saxpy(0.5f, x, y, n);
+      benchmark::DoNotOptimize(y);
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(3 * n * sizeof(float)));
+  }
+
+  void BM_Aligned_SaxpyMakeArray(benchmark::State &state)
+  {
+    run_saxpy<false>(state);
+  }
+
+  void BM_Aligned_SaxpyMakeArrayAligned(benchmark::State &state)
+  {
+    run_saxpy<true>(state);
+  }
+
+  // Small per-thread counter arrays allocated back to back: with make_array()
+  // they share cache lines, with make_array_aligned() each gets its own.
+  template <bool Aligned>
+  std::array<std::atomic<std::uint64_t> *, kMaxThreads> &counters()
+  {
+    static arena::Arena a(kMaxThreads * 2 * arena::cache_line_size);
+    static std::array<std::atomic<std::uint64_t> *, kMaxThreads> slots = []
+    {
+      std::array<std::atomic<std::uint64_t> *, kMaxThreads> s{};
+      for (auto &p : s)
+      {
+        if constexpr (Aligned)
+          p = a.make_array_aligned<std::atomic<std::uint64_t>>(1);
+        else
+          p = a.make_array<std::atomic<std::uint64_t>>(1);
+      }
+      return s;
+    }();
+    return slots;
+  }
+
+  template <bool Aligned>
+  void run_counters(benchmark::State &state)
+  {
+    std::atomic<std::uint64_t> &c = *counters<Aligned>()[static_cast<std::size_t>(state.thread_index()) % kMaxThreads];
+    for (auto _ : state)
+      c.fetch_add(1, std::memory_order_relaxed);
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Aligned_NeighbourCountersMakeArray(benchmark::State &state)
+  {
+    run_counters<false>(state);
+  }
+
+  void BM_Aligned_NeighbourCountersMakeArrayAligned(benchmark::State &state)
+  {
+    run_counters<true>(state);
+  }
+
+  // Allocate-and-write loop: first touches of fresh arena memory.
+  void BM_Aligned_AllocateAndFill(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    constexpr std::size_t kAllocs = 1024;
+    arena::Arena a(kAllocs * (size + arena::cache_line_size));
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+      {
+        auto *p = a.make_array<std::uint8_t>(size);
+        for (std::size_t j = 0; j < size; j += 8)
+          p[j] = static_cast<std::uint8_t>(j);
+        benchmark::DoNotOptimize(p);
+      }
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+}
+
+BENCHMARK(BM_Aligned_SaxpyMakeArray)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK(BM_Aligned_SaxpyMakeArrayAligned)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK(BM_Aligned_NeighbourCountersMakeArray)->ThreadRange(1, 8);
+BENCHMARK(BM_Aligned_NeighbourCountersMakeArrayAligned)->ThreadRange(1, 8);
+BENCHMARK(BM_Aligned_AllocateAndFill)->Arg(64)->Arg(256);
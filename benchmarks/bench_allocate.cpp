@@ -0,0 +1,118 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace
+{
+  constexpr std::size_t kAllocs = 1024;
+
+  struct Small
+  {
+    std::uint64_t a;
+    std::uint32_t b;
+    std::uint16_t c;
+  };
+
+  // range(0) = size, range(1) = alignment.
+  void BM_Arena_Allocate(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto align = static_cast<std::size_t>(state.range(1));
+    arena::Arena a(kAllocs * (size + align));
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(a.allocate(size, align));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+  void BM_Arena_MakeSmall(benchmark::State &state)
+  {
+    arena::Arena a(kAllocs * sizeof(Small));
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(a.make<Small>(Small{i, 1, 2}));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+  void BM_Arena_MakeString(benchmark::State &state)
+  {
+    arena::Arena a(kAllocs * sizeof(std::string));
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(a.make<std::string>("short"));
+      // Strings are small enough for SSO, so skipping the destructors is safe.
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+  void BM_Arena_MakeArray(benchmark::State &state)
+  {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(64 * n * sizeof(double));
+    for (auto _ : state)
+    {
+      for (int i = 0; i < 64; ++i)
+        benchmark::DoNotOptimize(a.make_array<double>(n));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+  }
+
+  void BM_Arena_ScopeChurn(benchmark::State &state)
+  {
+    arena::Arena a(1 << 16);
+    for (auto _ : state)
+    {
+      arena::Arena::Scope scope(a);
+      for (int i = 0; i < 16; ++i)
+        benchmark::DoNotOptimize(a.allocate(64, 16));
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+  }
+
+  void BM_Arena_Rewind(benchmark::State &state)
+  {
+    arena::Arena a(1 << 16);
+    (void)a.allocate(256);
+    const arena::Arena::Mark m = a.mark();
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(a.allocate(128));
+      a.rewind(m);
+    }
+  }
+
+  void BM_Arena_GrowableChain(benchmark::State &state)
+  {
+    arena::Arena a(4096, arena::Options{.growth_factor = 2.0});
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < 16 * kAllocs; ++i)
+        benchmark::DoNotOptimize(a.allocate(32, 8));
+      a.reset(); // chained blocks stay cached
+    }
+    state.SetItemsProcessed(state.iterations() * 16 * kAllocs);
+  }
+}
+
+BENCHMARK(BM_Arena_Allocate)
+    ->ArgsProduct({{8, 64, 512, 4096}, {1, 8, 16, 64}})
+    ->ArgNames({"size", "align"});
+BENCHMARK(BM_Arena_MakeSmall);
+BENCHMARK(BM_Arena_MakeString);
+BENCHMARK(BM_Arena_MakeArray)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_Arena_ScopeChurn);
+BENCHMARK(BM_Arena_Rewind);
+BENCHMARK(BM_Arena_GrowableChain);
@@ -0,0 +1,89 @@
+#include <arena/allocator.hpp>
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+// Standard containers with arena::Allocator<T> versus std::allocator<T>.
+// The arena never returns vector growth buffers or map nodes individually;
+// everything goes back with one reset().
+
+namespace
+{
+  constexpr std::size_t kElements = 4096;
+
+  template <class Vector>
+  void fill_vector(Vector &v)
+  {
+    for (std::size_t i = 0; i < kElements; ++i)
+      v.push_back(static_cast<int>(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+
+  void BM_Allocator_StdVector(benchmark::State &state)
+  {
+    for (auto _ : state)
+    {
+      std::vector<int> v;
+      fill_vector(v);
+    }
+    state.SetItemsProcessed(state.iterations() * kElements);
+  }
+
+  void BM_Allocator_ArenaVector(benchmark::State &state)
+  {
+    // Geometric growth leaves every old buffer behind: about 2x the final size.
+    arena::Arena a(4 * kElements * sizeof(int));
+    for (auto _ : state)
+    {
+      {
+        std::vector<int, arena::Allocator<int>> v{arena::Allocator<int>(a)};
+        fill_vector(v);
+      }
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kElements);
+  }
+
+  template <class Map>
+  void fill_map(Map &m)
+  {
+    for (std::size_t i = 0; i < kElements; ++i)
+      m.emplace(static_cast<int>((i * 2654435761u) % kElements), static_cast<int>(i));
+    benchmark::DoNotOptimize(m.size());
+  }
+
+  void BM_Allocator_StdMap(benchmark::State &state)
+  {
+    for (auto _ : state)
+    {
+      std::map<int, int> m;
+      fill_map(m);
+    }
+    state.SetItemsProcessed(state.iterations() * kElements);
+  }
+
+  void BM_Allocator_ArenaMap(benchmark::State &state)
+  {
+    using Alloc = arena::Allocator<std::pair<const int, int>>;
+    arena::Arena a(kElements * 64);
+    for (auto _ : state)
+    {
+      {
+        std::map<int, int, std::less<int>, Alloc> m{Alloc(a)};
+        fill_map(m);
+      }
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kElements);
+  }
+}
+
+BENCHMARK(BM_Allocator_StdVector);
+BENCHMARK(BM_Allocator_ArenaVector);
+BENCHMARK(BM_Allocator_StdMap);
+BENCHMARK(BM_Allocator_ArenaMap);
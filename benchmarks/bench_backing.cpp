@@ -0,0 +1,76 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Construct an arena and write one word per 4 KiB of it, for each way of
+// backing the initial buffer: plain heap, prefaulted heap, a reservation
+// committed on demand, and huge pages. The timing covers construction,
+// page faults and destruction, which is what the options trade against
+// each other.
+
+namespace
+{
+  constexpr std::size_t kArenaBytes = std::size_t{32} << 20;
+  constexpr std::size_t kStride = 4096;
+
+  void construct_and_touch(benchmark::State &state, const arena::Options &options)
+  {
+    for (auto _ : state)
+    {
+      arena::Arena a(kArenaBytes, options);
+      for (std::size_t i = 0; i < kArenaBytes / kStride; ++i)
+      {
+        auto *p = static_cast<std::uint64_t *>(a.allocate<alignof(std::uint64_t)>(kStride));
+        p[0] = i;
+        benchmark::DoNotOptimize(p);
+      }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kArenaBytes));
+  }
+
+  void BM_Backing_Heap(benchmark::State &state)
+  {
+    construct_and_touch(state, arena::Options{});
+  }
+
+  void BM_Backing_Prefault(benchmark::State &state)
+  {
+    construct_and_touch(state, arena::Options{.prefault = true});
+  }
+
+  // range(0) = commit granularity.
+  void BM_Backing_ReservedLazyCommit(benchmark::State &state)
+  {
+    construct_and_touch(state, arena::Options{.reserve_bytes = kArenaBytes,
+                                              .commit_granularity = static_cast<std::size_t>(state.range(0))});
+  }
+
+  // Reports which page size was actually obtained: explicit huge pages fall
+  // back to smaller ones when the system has none configured.
+  void huge_pages(benchmark::State &state, arena::HugePages pages)
+  {
+    const arena::HugePages got = arena::Arena(kArenaBytes, arena::Options{.huge_pages = pages}).huge_pages();
+    if (got != pages)
+      state.SetLabel("fell back to smaller pages");
+    construct_and_touch(state, arena::Options{.huge_pages = pages});
+  }
+
+  void BM_Backing_TransparentHugePages(benchmark::State &state)
+  {
+    huge_pages(state, arena::HugePages::transparent);
+  }
+
+  void BM_Backing_HugePages2M(benchmark::State &state)
+  {
+    huge_pages(state, arena::HugePages::size_2mb);
+  }
+}
+
+BENCHMARK(BM_Backing_Heap)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Backing_Prefault)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Backing_ReservedLazyCommit)->Arg(64 << 10)->Arg(2 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Backing_TransparentHugePages)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Backing_HugePages2M)->Unit(benchmark::kMillisecond);
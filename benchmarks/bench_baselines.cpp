@@ -0,0 +1,115 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <vector>
+
+#if defined(ARENA_BENCH_HAVE_MIMALLOC)
+#include <mimalloc.h>
+#endif
+
+#if defined(ARENA_BENCH_HAVE_JEMALLOC)
+#include <jemalloc/jemalloc.h>
+#endif
+
+// Allocate-then-free-everything rounds: the arena's bump + reset() against
+// general-purpose allocators doing the same amount of work.
+
+namespace
+{
+  constexpr std::size_t kAllocs = 1024;
+
+  void BM_Baseline_Arena(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(kAllocs * (size + alignof(std::max_align_t)));
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(a.allocate(size));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+  void BM_Baseline_Malloc(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<void *> ptrs(kAllocs);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+      {
+        ptrs[i] = std::malloc(size);
+        benchmark::DoNotOptimize(ptrs[i]);
+      }
+      for (void *p : ptrs)
+        std::free(p);
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+  void BM_Baseline_Monotonic(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<std::byte> buffer(kAllocs * (size + alignof(std::max_align_t)));
+    for (auto _ : state)
+    {
+      std::pmr::monotonic_buffer_resource res(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(res.allocate(size, alignof(std::max_align_t)));
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+#if defined(ARENA_BENCH_HAVE_MIMALLOC)
+  void BM_Baseline_Mimalloc(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<void *> ptrs(kAllocs);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+      {
+        ptrs[i] = mi_malloc(size);
+        benchmark::DoNotOptimize(ptrs[i]);
+      }
+      for (void *p : ptrs)
+        mi_free(p);
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+#endif
+
+#if defined(ARENA_BENCH_HAVE_JEMALLOC)
+  void BM_Baseline_Jemalloc(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<void *> ptrs(kAllocs);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+      {
+        ptrs[i] = mallocx(size, 0);
+        benchmark::DoNotOptimize(ptrs[i]);
+      }
+      for (void *p : ptrs)
+        dallocx(p, 0);
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+#endif
+}
+
+BENCHMARK(BM_Baseline_Arena)->Arg(16)->Arg(128)->Arg(1024);
+BENCHMARK(BM_Baseline_Malloc)->Arg(16)->Arg(128)->Arg(1024);
+BENCHMARK(BM_Baseline_Monotonic)->Arg(16)->Arg(128)->Arg(1024);
+#if defined(ARENA_BENCH_HAVE_MIMALLOC)
+BENCHMARK(BM_Baseline_Mimalloc)->Arg(16)->Arg(128)->Arg(1024);
+#endif
+#if defined(ARENA_BENCH_HAVE_JEMALLOC)
+BENCHMARK(BM_Baseline_Jemalloc)->Arg(16)->Arg(128)->Arg(1024);
+#endif
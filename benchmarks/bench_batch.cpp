@@ -0,0 +1,48 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+  struct Node
+  {
+    std::uint32_t kind;
+    std::uint32_t pos;
+    Node *next;
+
+    Node(std::uint32_t k, std::uint32_t p) : kind(k), pos(p), next(nullptr) {}
+  };
+
+  void BM_Batch_MakeLoop(benchmark::State &state)
+  {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(n * sizeof(Node));
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        benchmark::DoNotOptimize(a.make<Node>(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i)));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Batch_MakeBatch(benchmark::State &state)
+  {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(n * sizeof(Node));
+    for (auto _ : state)
+    {
+      auto nodes = a.make_batch<Node>(n, [](std::size_t i)
+                                      { return Node(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i)); });
+      benchmark::DoNotOptimize(nodes.data());
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+}
+
+BENCHMARK(BM_Batch_MakeLoop)->Arg(64)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Batch_MakeBatch)->Arg(64)->Arg(1024)->Arg(16384);
@@ -0,0 +1,84 @@
+#include <arena/arena.hpp>
+#include <arena/concurrent_arena.hpp>
+#include <arena/lease.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+namespace
+{
+  constexpr std::size_t kAllocSize = 16;
+  constexpr std::size_t kPerThreadBytes = std::size_t{4} << 20;
+
+  // The shared arena cannot be reset while threads allocate, so the
+  // iteration count is fixed to bound its footprint (4 MiB per thread).
+  constexpr benchmark::IterationCount kIterations = kPerThreadBytes / kAllocSize;
+
+  arena::ConcurrentArena *g_shared = nullptr;
+
+  // Many threads bumping one shared arena.
+  void BM_ConcurrentArena_Shared(benchmark::State &state)
+  {
+    if (state.thread_index() == 0)
+    {
+      g_shared = new arena::ConcurrentArena(kPerThreadBytes, arena::Options{.growth_factor = 2.0});
+    }
+
+    for (auto _ : state)
+      benchmark::DoNotOptimize(g_shared->allocate(kAllocSize, 8));
+
+    if (state.thread_index() == 0)
+    {
+      delete g_shared;
+      g_shared = nullptr;
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  // Threads lease 64 KiB sub-chunks from the shared arena and bump inside them.
+  void BM_ConcurrentArena_Leased(benchmark::State &state)
+  {
+    if (state.thread_index() == 0)
+    {
+      g_shared = new arena::ConcurrentArena(kPerThreadBytes, arena::Options{.growth_factor = 2.0});
+    }
+
+    {
+      arena::Lease lease(*g_shared);
+      for (auto _ : state)
+        benchmark::DoNotOptimize(lease->allocate(kAllocSize, 8));
+
+      state.counters["wasted_bytes"] = benchmark::Counter(static_cast<double>(lease.stats().wasted_bytes));
+    }
+
+    if (state.thread_index() == 0)
+    {
+      delete g_shared;
+      g_shared = nullptr;
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  // Baseline: one private Arena per thread, reset whenever it fills up.
+  void BM_Arena_PerThread(benchmark::State &state)
+  {
+    arena::Arena a(kPerThreadBytes);
+
+    for (auto _ : state)
+    {
+      void *p = a.try_allocate(kAllocSize, 8);
+      if (!p)
+      {
+        a.reset();
+        p = a.try_allocate(kAllocSize, 8);
+      }
+      benchmark::DoNotOptimize(p);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+}
+
+BENCHMARK(BM_ConcurrentArena_Shared)->ThreadRange(1, 64)->Iterations(kIterations)->UseRealTime();
+BENCHMARK(BM_ConcurrentArena_Leased)->ThreadRange(1, 64)->Iterations(kIterations)->UseRealTime();
+BENCHMARK(BM_Arena_PerThread)->ThreadRange(1, 64)->Iterations(kIterations)->UseRealTime();
@@ -0,0 +1,117 @@
+#include <arena/flat_map.hpp>
+#include <arena/pool.hpp>
+#include <arena/vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+  struct Timer
+  {
+    std::uint64_t deadline;
+    void *user;
+  };
+
+  void BM_Containers_ArenaVector(benchmark::State &state)
+  {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(4 * n * sizeof(int) + 4096);
+    for (auto _ : state)
+    {
+      arena::Vector<int> v(a);
+      for (std::size_t i = 0; i < n; ++i)
+        v.push_back(static_cast<int>(i));
+      benchmark::DoNotOptimize(v.data());
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Containers_StdVector(benchmark::State &state)
+  {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+      std::vector<int> v;
+      for (std::size_t i = 0; i < n; ++i)
+        v.push_back(static_cast<int>(i));
+      benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Containers_FlatMap(benchmark::State &state)
+  {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(64 * n + 4096);
+    for (auto _ : state)
+    {
+      arena::FlatMap<std::uint32_t, std::uint32_t> m(a);
+      for (std::size_t i = 0; i < n; ++i)
+        m[static_cast<std::uint32_t>(i * 7)] = static_cast<std::uint32_t>(i);
+      benchmark::DoNotOptimize(m.find(7));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Containers_UnorderedMap(benchmark::State &state)
+  {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+      std::unordered_map<std::uint32_t, std::uint32_t> m;
+      for (std::size_t i = 0; i < n; ++i)
+        m[static_cast<std::uint32_t>(i * 7)] = static_cast<std::uint32_t>(i);
+      benchmark::DoNotOptimize(m.find(7));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  // Steady-state churn: destroy one timer and create another each step.
+  void BM_Containers_PoolChurn(benchmark::State &state)
+  {
+    arena::Arena a(1 << 20);
+    arena::Pool<Timer> pool(a);
+    std::vector<Timer *> live(256);
+    for (auto &t : live)
+      t = pool.create(Timer{0, nullptr});
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+      pool.destroy(live[i]);
+      live[i] = pool.create(Timer{i, nullptr});
+      benchmark::DoNotOptimize(live[i]);
+      i = (i + 1) % live.size();
+    }
+  }
+
+  void BM_Containers_NewDeleteChurn(benchmark::State &state)
+  {
+    std::vector<std::unique_ptr<Timer>> live(256);
+    for (auto &t : live)
+      t = std::make_unique<Timer>();
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+      live[i] = std::make_unique<Timer>(Timer{i, nullptr});
+      benchmark::DoNotOptimize(live[i].get());
+      i = (i + 1) % live.size();
+    }
+  }
+}
+
+BENCHMARK(BM_Containers_ArenaVector)->Arg(64)->Arg(4096)->Arg(65536);
+BENCHMARK(BM_Containers_StdVector)->Arg(64)->Arg(4096)->Arg(65536);
+BENCHMARK(BM_Containers_FlatMap)->Arg(64)->Arg(4096);
+BENCHMARK(BM_Containers_UnorderedMap)->Arg(64)->Arg(4096);
+BENCHMARK(BM_Containers_PoolChurn);
+BENCHMARK(BM_Containers_NewDeleteChurn);
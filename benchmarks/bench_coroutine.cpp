@@ -0,0 +1,88 @@
+#include <arena/coroutine.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace
+{
+  struct HeapPromise
+  {
+  };
+
+  // Lazy task whose promise takes its operator new/delete from Base.
+  template <class Base>
+  struct Task
+  {
+    struct promise_type : Base
+    {
+      std::uint64_t value = 0;
+
+      Task get_return_object() { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; }
+      void return_value(std::uint64_t v) noexcept { value = v; }
+      void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit Task(std::coroutine_handle<promise_type> h) noexcept : handle(h) {}
+    Task(Task &&other) noexcept : handle(std::exchange(other.handle, {})) {}
+    Task(const Task &) = delete;
+
+    ~Task()
+    {
+      if (handle)
+        handle.destroy();
+    }
+
+    std::uint64_t get()
+    {
+      handle.resume();
+      return handle.promise().value;
+    }
+
+    std::coroutine_handle<promise_type> handle;
+  };
+
+  // A request handler calling depth nested coroutines, each awaited to
+  // completion: depth + 1 frames per call.
+  template <class Base>
+  Task<Base> chain(std::allocator_arg_t, arena::Arena &a, int depth)
+  {
+    if (depth == 0)
+      co_return 1;
+    Task<Base> inner = chain<Base>(std::allocator_arg, a, depth - 1);
+    co_return inner.get() + 1;
+  }
+
+  template <class Base>
+  void run_chain(benchmark::State &state)
+  {
+    const auto depth = static_cast<int>(state.range(0));
+    arena::Arena a(1 << 20);
+    for (auto _ : state)
+    {
+      Task<Base> t = chain<Base>(std::allocator_arg, a, depth);
+      benchmark::DoNotOptimize(t.get());
+    }
+    state.counters["frames/s"] =
+        benchmark::Counter(static_cast<double>(state.iterations() * (depth + 1)), benchmark::Counter::kIsRate);
+  }
+
+  void BM_Coroutine_HeapFrames(benchmark::State &state)
+  {
+    run_chain<HeapPromise>(state);
+  }
+
+  void BM_Coroutine_ArenaFrames(benchmark::State &state)
+  {
+    run_chain<arena::ArenaPromise>(state);
+  }
+}
+
+BENCHMARK(BM_Coroutine_HeapFrames)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK(BM_Coroutine_ArenaFrames)->Arg(1)->Arg(8)->Arg(64);
@@ -0,0 +1,77 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Cost of Options::track_destructors: make() also records a finalizer and
+// reset() walks the records, versus calling the destructors by hand.
+// Trivially destructible types are never recorded, so the tracked arena
+// pays nothing extra for them.
+
+namespace
+{
+  constexpr std::size_t kObjects = 1024;
+
+  struct Handle
+  {
+    std::uint64_t *live;
+    explicit Handle(std::uint64_t *l) noexcept : live(l) { ++*live; }
+    ~Handle() { --*live; }
+  };
+
+  struct Plain
+  {
+    std::uint64_t a;
+    std::uint64_t b;
+  };
+
+  void BM_Destructors_Manual(benchmark::State &state)
+  {
+    std::uint64_t live = 0;
+    arena::Arena a(kObjects * 64);
+    Handle *objects[kObjects];
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kObjects; ++i)
+        objects[i] = a.make<Handle>(&live);
+      for (std::size_t i = kObjects; i-- > 0;)
+        objects[i]->~Handle();
+      a.reset();
+    }
+    benchmark::DoNotOptimize(live);
+    state.SetItemsProcessed(state.iterations() * kObjects);
+  }
+
+  void BM_Destructors_Tracked(benchmark::State &state)
+  {
+    std::uint64_t live = 0;
+    arena::Arena a(kObjects * 64, arena::Options{.track_destructors = true});
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kObjects; ++i)
+        benchmark::DoNotOptimize(a.make<Handle>(&live));
+      a.reset();
+    }
+    benchmark::DoNotOptimize(live);
+    state.SetItemsProcessed(state.iterations() * kObjects);
+  }
+
+  // range(0) = track_destructors.
+  void BM_Destructors_Trivial(benchmark::State &state)
+  {
+    arena::Arena a(kObjects * 64, arena::Options{.track_destructors = state.range(0) != 0});
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kObjects; ++i)
+        benchmark::DoNotOptimize(a.make<Plain>(Plain{i, i}));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kObjects);
+  }
+}
+
+BENCHMARK(BM_Destructors_Manual);
+BENCHMARK(BM_Destructors_Tracked);
+BENCHMARK(BM_Destructors_Trivial)->Arg(0)->Arg(1);
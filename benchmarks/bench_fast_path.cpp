@@ -0,0 +1,52 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+namespace
+{
+  constexpr std::size_t kAllocs = 4096;
+
+  void BM_FastPath_RuntimeAlign(benchmark::State &state)
+  {
+    arena::Arena a(kAllocs * 16);
+    std::size_t align = alignof(int);
+    benchmark::DoNotOptimize(align);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(a.allocate(sizeof(int), align));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+  void BM_FastPath_StaticAlign(benchmark::State &state)
+  {
+    arena::Arena a(kAllocs * 16);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(a.allocate<alignof(int)>(sizeof(int)));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+  void BM_FastPath_MakeInt(benchmark::State &state)
+  {
+    arena::Arena a(kAllocs * 16);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(a.make<int>(static_cast<int>(i)));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+}
+
+BENCHMARK(BM_FastPath_RuntimeAlign);
+BENCHMARK(BM_FastPath_StaticAlign);
+BENCHMARK(BM_FastPath_MakeInt);
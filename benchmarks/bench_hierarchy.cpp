@@ -0,0 +1,101 @@
+#include <arena/arena.hpp>
+#include <arena/frame_arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Per-request child arenas carved from a parent (SubArena) versus a fresh
+// heap arena or a Scope per request, and a FrameArena ring keeping the last
+// frames alive versus heap objects freed N frames later.
+
+namespace
+{
+  constexpr std::size_t kRequestBytes = 4096;
+  constexpr std::size_t kPerRequest = 32;
+  constexpr std::size_t kPerFrame = 256;
+  constexpr std::size_t kFrames = 3;
+
+  struct Item
+  {
+    std::uint64_t id;
+    std::uint64_t payload[7];
+  };
+
+  void fill(arena::Arena &a)
+  {
+    for (std::size_t i = 0; i < kPerRequest; ++i)
+      benchmark::DoNotOptimize(a.allocate(64));
+  }
+
+  void BM_SubArena_Child(benchmark::State &state)
+  {
+    arena::Arena parent(1 << 20);
+    for (auto _ : state)
+    {
+      arena::SubArena request = parent.child(kRequestBytes);
+      fill(request);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_SubArena_HeapArena(benchmark::State &state)
+  {
+    for (auto _ : state)
+    {
+      arena::Arena request(kRequestBytes);
+      fill(request);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_SubArena_Scope(benchmark::State &state)
+  {
+    arena::Arena parent(1 << 20);
+    for (auto _ : state)
+    {
+      arena::Arena::Scope request(parent);
+      fill(parent);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_FrameArena_Advance(benchmark::State &state)
+  {
+    arena::FrameArena<kFrames> frames(kPerFrame * (sizeof(Item) + arena::Arena::redzone_size));
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kPerFrame; ++i)
+        benchmark::DoNotOptimize(frames->make<Item>(Item{i, {}}));
+      frames.advance();
+    }
+    state.SetItemsProcessed(state.iterations() * kPerFrame);
+  }
+
+  // Same lifetime with the heap: each frame's objects are freed kFrames
+  // frames later.
+  void BM_FrameArena_HeapDeferred(benchmark::State &state)
+  {
+    std::array<std::vector<std::unique_ptr<Item>>, kFrames> frames;
+    std::size_t current = 0;
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kPerFrame; ++i)
+        frames[current].push_back(std::make_unique<Item>(Item{i, {}}));
+      benchmark::DoNotOptimize(frames[current].data());
+      current = (current + 1) % kFrames;
+      frames[current].clear();
+    }
+    state.SetItemsProcessed(state.iterations() * kPerFrame);
+  }
+}
+
+BENCHMARK(BM_SubArena_Child);
+BENCHMARK(BM_SubArena_HeapArena);
+BENCHMARK(BM_SubArena_Scope);
+BENCHMARK(BM_FrameArena_Advance);
+BENCHMARK(BM_FrameArena_HeapDeferred);
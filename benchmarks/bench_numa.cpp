@@ -0,0 +1,71 @@
+#include <arena/arena.hpp>
+#include <arena/detail/vm.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+// Bump-allocate and write through an arena bound to the local node versus
+// one bound to a remote node. The remote case is skipped on single-node
+// machines.
+
+namespace
+{
+  constexpr std::size_t kArenaBytes = std::size_t{64} << 20;
+  constexpr std::size_t kNodeSize = 64;
+
+  int numa_node_count()
+  {
+    // e.g. "0-1" or "0"
+    std::ifstream in("/sys/devices/system/node/online");
+    std::string line;
+    if (!std::getline(in, line) || line.empty())
+      return 1;
+    const std::size_t dash = line.find_last_of("-,");
+    return std::stoi(dash == std::string::npos ? line : line.substr(dash + 1)) + 1;
+  }
+
+  void bump_and_touch(benchmark::State &state, int node)
+  {
+    arena::Arena a(kArenaBytes, arena::Options{.prefault = true, .numa_node = node});
+    if (a.numa_node() != node)
+    {
+      state.SkipWithError("mbind is not available");
+      return;
+    }
+
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kArenaBytes / kNodeSize; ++i)
+      {
+        auto *p = static_cast<std::uint64_t *>(a.allocate<kNodeSize>(kNodeSize));
+        p[0] = i;
+        benchmark::DoNotOptimize(p);
+      }
+      a.reset();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kArenaBytes));
+  }
+
+  void BM_Numa_LocalNode(benchmark::State &state)
+  {
+    bump_and_touch(state, arena::detail::vm::current_numa_node());
+  }
+
+  void BM_Numa_RemoteNode(benchmark::State &state)
+  {
+    const int nodes = numa_node_count();
+    if (nodes < 2)
+    {
+      state.SkipWithError("single NUMA node");
+      return;
+    }
+    bump_and_touch(state, (arena::detail::vm::current_numa_node() + 1) % nodes);
+  }
+}
+
+BENCHMARK(BM_Numa_LocalNode)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Numa_RemoteNode)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,59 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// A fixed arena that routes the occasional oversize request to
+// Options::overflow, versus the caller catching bad_alloc and tracking
+// heap fallbacks by hand. range(0) = one oversize request every N.
+
+namespace
+{
+  constexpr std::size_t kAllocs = 1024;
+  constexpr std::size_t kSmall = 32;
+  constexpr std::size_t kLarge = 64 * 1024;
+
+  void BM_Overflow_Routed(benchmark::State &state)
+  {
+    const auto every = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(kAllocs * kSmall, arena::Options{.overflow = std::pmr::new_delete_resource()});
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+        benchmark::DoNotOptimize(a.allocate(i % every == 0 ? kLarge : kSmall));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+
+  void BM_Overflow_ManualFallback(benchmark::State &state)
+  {
+    const auto every = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(kAllocs * kSmall);
+    std::vector<std::unique_ptr<std::byte[]>> spilled;
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kAllocs; ++i)
+      {
+        const std::size_t size = i % every == 0 ? kLarge : kSmall;
+        void *p = a.try_allocate(size);
+        if (!p)
+        {
+          spilled.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+          p = spilled.back().get();
+        }
+        benchmark::DoNotOptimize(p);
+      }
+      spilled.clear();
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocs);
+  }
+}
+
+BENCHMARK(BM_Overflow_Routed)->Arg(16)->Arg(256);
+BENCHMARK(BM_Overflow_ManualFallback)->Arg(16)->Arg(256);
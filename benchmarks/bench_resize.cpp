@@ -0,0 +1,118 @@
+#include <arena/arena.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// Growing a buffer in place versus copying it, and freeing LIFO
+// temporaries with deallocate() versus a Mark per temporary.
+
+namespace
+{
+  constexpr std::size_t kChunk = 64;
+  constexpr std::size_t kChunks = 1024;
+  constexpr std::size_t kTemps = 1024;
+
+  // The buffer is the arena's most recent allocation, so every growth is
+  // an in-place try_resize().
+  void BM_Resize_InPlace(benchmark::State &state)
+  {
+    arena::Arena a(kChunk * kChunks);
+    for (auto _ : state)
+    {
+      std::size_t size = kChunk;
+      auto *buf = static_cast<std::byte *>(a.allocate(size));
+      for (std::size_t i = 1; i < kChunks; ++i)
+      {
+        buf = static_cast<std::byte *>(a.reallocate(buf, size, size + kChunk));
+        std::memset(buf + size, static_cast<int>(i), kChunk);
+        size += kChunk;
+      }
+      benchmark::DoNotOptimize(buf);
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kChunks);
+  }
+
+  // A one-byte allocation after each growth pins the buffer, so reallocate()
+  // has to move and copy it every time.
+  void BM_Resize_Copy(benchmark::State &state)
+  {
+    arena::Arena a(kChunk * kChunks * kChunks);
+    for (auto _ : state)
+    {
+      std::size_t size = kChunk;
+      auto *buf = static_cast<std::byte *>(a.allocate(size));
+      for (std::size_t i = 1; i < kChunks; ++i)
+      {
+        benchmark::DoNotOptimize(a.allocate<1>(1));
+        buf = static_cast<std::byte *>(a.reallocate(buf, size, size + kChunk));
+        std::memset(buf + size, static_cast<int>(i), kChunk);
+        size += kChunk;
+      }
+      benchmark::DoNotOptimize(buf);
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * kChunks);
+  }
+
+  void BM_Resize_StdRealloc(benchmark::State &state)
+  {
+    for (auto _ : state)
+    {
+      std::size_t size = kChunk;
+      auto *buf = static_cast<std::byte *>(std::malloc(size));
+      for (std::size_t i = 1; i < kChunks; ++i)
+      {
+        buf = static_cast<std::byte *>(std::realloc(buf, size + kChunk));
+        std::memset(buf + size, static_cast<int>(i), kChunk);
+        size += kChunk;
+      }
+      benchmark::DoNotOptimize(buf);
+      std::free(buf);
+    }
+    state.SetItemsProcessed(state.iterations() * kChunks);
+  }
+
+  // range(0) = temporary size.
+  void BM_Deallocate_Lifo(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(2 * size + 64);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kTemps; ++i)
+      {
+        void *p = a.allocate(size);
+        benchmark::DoNotOptimize(p);
+        a.deallocate(p, size);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * kTemps);
+  }
+
+  void BM_Deallocate_MarkRewind(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(2 * size + 64);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < kTemps; ++i)
+      {
+        const arena::Arena::Mark m = a.mark();
+        benchmark::DoNotOptimize(a.allocate(size));
+        a.rewind(m);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * kTemps);
+  }
+}
+
+BENCHMARK(BM_Resize_InPlace);
+BENCHMARK(BM_Resize_Copy);
+BENCHMARK(BM_Resize_StdRealloc);
+BENCHMARK(BM_Deallocate_Lifo)->Arg(16)->Arg(256);
+BENCHMARK(BM_Deallocate_MarkRewind)->Arg(16)->Arg(256);
@@ -0,0 +1,84 @@
+#include <arena/resource.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+  constexpr std::size_t kBufferBytes = std::size_t{8} << 20;
+
+  // Builds a small request-handler style container graph.
+  void build_graph(std::pmr::memory_resource *res, int n)
+  {
+    std::pmr::vector<int> ids(res);
+    std::pmr::unordered_map<int, std::pmr::string> names(res);
+    for (int i = 0; i < n; ++i)
+    {
+      ids.push_back(i);
+      names.emplace(i, "some header value that does not fit in SSO");
+    }
+    benchmark::DoNotOptimize(ids.data());
+    benchmark::DoNotOptimize(names.size());
+  }
+
+  void BM_Resource_ArenaGraph(benchmark::State &state)
+  {
+    arena::Arena a(kBufferBytes);
+    arena::Resource res(a);
+    for (auto _ : state)
+    {
+      build_graph(&res, static_cast<int>(state.range(0)));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Resource_MonotonicGraph(benchmark::State &state)
+  {
+    std::vector<std::byte> buffer(kBufferBytes);
+    for (auto _ : state)
+    {
+      std::pmr::monotonic_buffer_resource res(buffer.data(), buffer.size());
+      build_graph(&res, static_cast<int>(state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Resource_Arena(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    arena::Arena a(kBufferBytes);
+    arena::Resource res(a);
+    for (auto _ : state)
+    {
+      for (int i = 0; i < 1024; ++i)
+        benchmark::DoNotOptimize(res.allocate(size, 8));
+      a.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+  }
+
+  void BM_Resource_Monotonic(benchmark::State &state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<std::byte> buffer(kBufferBytes);
+    std::pmr::monotonic_buffer_resource res(buffer.data(), buffer.size());
+    for (auto _ : state)
+    {
+      for (int i = 0; i < 1024; ++i)
+        benchmark::DoNotOptimize(res.allocate(size, 8));
+      res.release();
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+  }
+}
+
+BENCHMARK(BM_Resource_ArenaGraph)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_Resource_MonotonicGraph)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_Resource_Arena)->Arg(8)->Arg(64)->Arg(512);
+BENCHMARK(BM_Resource_Monotonic)->Arg(8)->Arg(64)->Arg(512);
@@ -0,0 +1,112 @@
+#include <arena/size_class.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+// Individual alloc/free with mixed sizes: the size-class allocator against
+// the malloc fast path (glibc by default; LD_PRELOAD tcmalloc or jemalloc
+// to compare against those).
+
+namespace
+{
+  constexpr std::size_t kWindow = 256;
+
+  // Sizes cycling through 8..4096, skewed towards small objects.
+  std::array<std::size_t, 64> make_sizes()
+  {
+    std::array<std::size_t, 64> sizes{};
+    std::uint32_t x = 12345;
+    for (auto &s : sizes)
+    {
+      x = x * 1103515245u + 12345u;
+      const std::uint32_t r = (x >> 16) & 0xffff;
+      s = r < 0xc000 ? 8 + r % 248 : 256 + r % 3841;
+    }
+    return sizes;
+  }
+
+  const std::array<std::size_t, 64> kSizes = make_sizes();
+
+  void BM_SizeClass_AllocFree(benchmark::State &state)
+  {
+    arena::Arena a(8 << 20);
+    arena::SizeClassAllocator slab(a);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+      const std::size_t size = kSizes[i++ % kSizes.size()];
+      void *p = slab.allocate(size);
+      benchmark::DoNotOptimize(p);
+      slab.deallocate(p, size);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Malloc_AllocFree(benchmark::State &state)
+  {
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+      const std::size_t size = kSizes[i++ % kSizes.size()];
+      void *p = std::malloc(size);
+      benchmark::DoNotOptimize(p);
+      std::free(p);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  // A window of live objects where each step frees one and allocates a
+  // replacement of a different size: mixed lifetimes, no global reset.
+  void BM_SizeClass_Churn(benchmark::State &state)
+  {
+    arena::Arena a(16 << 20);
+    arena::SizeClassAllocator slab(a);
+    std::array<void *, kWindow> live{};
+    std::array<std::size_t, kWindow> sizes{};
+    for (std::size_t k = 0; k < kWindow; ++k)
+    {
+      sizes[k] = kSizes[k % kSizes.size()];
+      live[k] = slab.allocate(sizes[k]);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+      const std::size_t k = (i * 97) % kWindow;
+      slab.deallocate(live[k], sizes[k]);
+      sizes[k] = kSizes[i++ % kSizes.size()];
+      live[k] = slab.allocate(sizes[k]);
+      benchmark::DoNotOptimize(live[k]);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Malloc_Churn(benchmark::State &state)
+  {
+    std::array<void *, kWindow> live{};
+    for (std::size_t k = 0; k < kWindow; ++k)
+      live[k] = std::malloc(kSizes[k % kSizes.size()]);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+      const std::size_t k = (i * 97) % kWindow;
+      std::free(live[k]);
+      live[k] = std::malloc(kSizes[i++ % kSizes.size()]);
+      benchmark::DoNotOptimize(live[k]);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    for (void *p : live)
+      std::free(p);
+  }
+}
+
+BENCHMARK(BM_SizeClass_AllocFree);
+BENCHMARK(BM_Malloc_AllocFree);
+BENCHMARK(BM_SizeClass_Churn);
+BENCHMARK(BM_Malloc_Churn);
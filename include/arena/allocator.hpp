@@ -0,0 +1,129 @@
+#pragma once
+
+#include <arena/arena.hpp>
+#include <arena/thread_scratch.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace arena
+{
+  /**
+   * @brief Standard Allocator that allocates from an Arena.
+   *
+   * Works with any allocator-aware container (std::vector<T, Alloc>,
+   * std::map, third-party hash maps, ...). Node-based containers get the
+   * same locality that make() gives: consecutive nodes are laid out next
+   * to each other in the arena.
+   *
+   * @code
+   * arena::Arena a(1 << 20);
+   * std::vector<int, arena::Allocator<int>> v{arena::Allocator<int>(a)};
+   * @endcode
+   *
+   * deallocate() only reclaims the arena's most recent allocation; other
+   * memory comes back on reset()/rewind().
+   * Two allocators compare equal when they use the same arena.
+   */
+  template <class T>
+  class Allocator
+  {
+  public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    /**
+     * @brief Create an allocator for an arena.
+     * @param a Arena to allocate from. Must outlive every container using it.
+     */
+    Allocator(Arena &a) noexcept : arena_(&a) {}
+
+    /// @brief Rebinding constructor.
+    template <class U>
+    Allocator(const Allocator<U> &other) noexcept : arena_(&other.arena())
+    {
+    }
+
+    /**
+     * @brief Allocate storage for n objects of type T.
+     * @throws std::bad_alloc If the arena is exhausted or n is too large.
+     */
+    [[nodiscard]] T *allocate(std::size_t n)
+    {
+      if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        throw std::bad_alloc{};
+      return static_cast<T *>(arena_->allocate(sizeof(T) * n, alignof(T)));
+    }
+
+    /// @brief Give the storage back if it is the arena's most recent allocation.
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+      (void)arena_->try_deallocate(p, sizeof(T) * n);
+    }
+
+    /// @return The arena this allocator uses.
+    [[nodiscard]] Arena &arena() const noexcept { return *arena_; }
+
+    template <class U>
+    friend bool operator==(const Allocator &a, const Allocator<U> &b) noexcept
+    {
+      return &a.arena() == &b.arena();
+    }
+
+  private:
+    Arena *arena_;
+  };
+
+  /**
+   * @brief Stateless Allocator that allocates from thread_scratch().
+   *
+   * Has no members, so containers using it are as small as with
+   * std::allocator. Every instance compares equal.
+   *
+   * @warning Memory comes from the scratch arena of the thread calling
+   *          allocate(). Containers must not outlive the enclosing
+   *          Scope (or reset) of that arena.
+   */
+  template <class T>
+  class ScratchAllocator
+  {
+  public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    ScratchAllocator() noexcept = default;
+
+    /// @brief Rebinding constructor.
+    template <class U>
+    ScratchAllocator(const ScratchAllocator<U> &) noexcept
+    {
+    }
+
+    /**
+     * @brief Allocate storage for n objects of type T.
+     * @throws std::bad_alloc If allocation fails or n is too large.
+     */
+    [[nodiscard]] T *allocate(std::size_t n)
+    {
+      if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        throw std::bad_alloc{};
+      return static_cast<T *>(thread_scratch().allocate(sizeof(T) * n, alignof(T)));
+    }
+
+    /// @brief Give the storage back if it is the scratch arena's most recent allocation.
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+      (void)thread_scratch().try_deallocate(p, sizeof(T) * n);
+    }
+
+    template <class U>
+    friend bool operator==(const ScratchAllocator &, const ScratchAllocator<U> &) noexcept
+    {
+      return true;
+    }
+  };
+} // namespace arena
@@ -1,27 +1,230 @@
 #pragma once
 
+#include <array>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
 #include <new>
+#include <span>
 #include <type_traits>
 #include <utility>
-#include <vector>
+
+#include <arena/detail/call_site.hpp>
+#include <arena/detail/poison.hpp>
+#include <arena/detail/vm.hpp>
+#include <arena/stats.hpp>
+
+#if ARENA_ENABLE_TRACING
+#include <arena/trace.hpp>
+#endif
+
+/**
+ * @brief Set to 1 to assert that Arena::deallocate() frees in LIFO order.
+ *
+ * Off by default. When on (and NDEBUG is not defined), deallocate() asserts
+ * that it is given the most recent live allocation, with the size it was
+ * allocated (or last resized) with. try_deallocate() never asserts.
+ */
+#ifndef ARENA_ENABLE_LIFO_CHECKS
+#define ARENA_ENABLE_LIFO_CHECKS 0
+#endif
+
+/**
+ * @brief Bytes ahead of the bump pointer to prefetch for writing, 0 for none.
+ *
+ * When set (e.g. to 256 or 512), every fast-path allocation issues a write
+ * prefetch that far past the new offset, so tight allocation loops find the
+ * next region already in cache. Only has an effect with GCC and Clang.
+ */
+#ifndef ARENA_PREFETCH_DISTANCE
+#define ARENA_PREFETCH_DISTANCE 0
+#endif
 
 namespace arena
 {
+  /// @brief Alignment that keeps data on its own cache line(s).
+  inline constexpr std::size_t cache_line_size = 64;
+
+  /**
+   * @brief Page size requested for (or obtained by) an arena buffer.
+   */
+  enum class HugePages : unsigned char
+  {
+    /// @brief Regular system pages.
+    none,
+
+    /// @brief Regular pages advised for transparent huge pages (madvise(MADV_HUGEPAGE)).
+    transparent,
+
+    /// @brief Explicit 2 MiB huge pages (MAP_HUGETLB, Windows large pages).
+    size_2mb,
+
+    /// @brief Explicit 1 GiB huge pages (MAP_HUGETLB).
+    size_1gb,
+  };
+
+  /**
+   * @brief Construction options for Arena.
+   *
+   * The defaults describe a plain fixed-size arena.
+   */
+  struct Options
+  {
+    /**
+     * @brief Growth factor applied when chaining a new block.
+     *
+     * 0 keeps the arena fixed-size: try_allocate() returns nullptr once the
+     * initial buffer is full. Any other value makes the arena growable: when
+     * the current block runs out, a new block of
+     * (current block size * growth_factor) bytes is chained. A reserved
+     * initial buffer (reserve_bytes) counts as min_block_size here, so a
+     * large reservation does not size the first block after it.
+     * Values below 1 are treated as 1.
+     */
+    double growth_factor = 0.0;
+
+    /// @brief Minimum size in bytes of a chained block.
+    std::size_t min_block_size = 4096;
+
+    /**
+     * @brief Keep chained blocks released by rewind()/reset() for reuse.
+     *
+     * When false, rewind() frees the chained blocks it no longer needs and
+     * reset() only keeps the largest one. Cached blocks can always be
+     * released explicitly with Arena::trim().
+     */
+    bool cache_blocks = true;
+
+    /**
+     * @brief Touch every page of the initial buffer at construction.
+     *
+     * The buffer is left uninitialized by default, so constructing an arena
+     * is O(1) and the OS commits pages lazily on first use. Latency-critical
+     * users can set this to pay the page faults up front instead.
+     */
+    bool prefault = false;
+
+    /**
+     * @brief Reserve this many bytes of address space for the initial buffer.
+     *
+     * 0 allocates the initial buffer from the heap. Any other value reserves
+     * a virtual range of max(reserve_bytes, capacity_bytes) bytes up front
+     * (mmap(PROT_NONE) / VirtualAlloc(MEM_RESERVE)) and commits it in
+     * commit_granularity chunks as allocations move forward. Pointers never
+     * move and the bump path has no chaining overhead.
+     */
+    std::size_t reserve_bytes = 0;
+
+    /// @brief Bytes committed at a time in a reserved arena (rounded to pages).
+    std::size_t commit_granularity = 64 * 1024;
+
+    /**
+     * @brief Committed bytes kept by reset()/rewind() in a reserved arena.
+     *
+     * When a rewind leaves more than this many bytes committed past the new
+     * offset, the excess is returned to the OS, so one unusually large
+     * request does not pin memory forever. The default never decommits.
+     */
+    std::size_t decommit_threshold = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Page size to request for the initial buffer.
+     *
+     * Explicit huge pages are committed in full at construction. When they
+     * are unavailable the arena falls back to the next smaller option
+     * (1 GiB -> 2 MiB -> transparent -> none), so construction only fails
+     * if no memory can be obtained at all. Combined with reserve_bytes,
+     * explicit huge pages are downgraded to transparent ones so the
+     * reservation can still be committed lazily.
+     * The buffer size is rounded up to the page size obtained.
+     */
+    HugePages huge_pages = HugePages::none;
+
+    /**
+     * @brief Where chained blocks come from.
+     *
+     * nullptr uses the global operator new. Pointing this at a shared
+     * arena::BlockPool lets many arenas recycle the same blocks without
+     * touching the system allocator. The resource must outlive the arena.
+     */
+    std::pmr::memory_resource *upstream = nullptr;
+
+    /**
+     * @brief Run destructors of objects created with make()/make_array().
+     *
+     * When set, every object whose type is not trivially destructible gets
+     * a small destructor record stored in the arena itself. reset(),
+     * rewind() and ~Scope run those destructors in LIFO order, back to the
+     * mark they rewind to. Trivially destructible types never pay for this.
+     */
+    bool track_destructors = false;
+
+    /// @brief numa_node value: leave placement to the OS (first touch).
+    static constexpr int no_numa_node = -1;
+
+    /// @brief numa_node value: the node of the thread constructing the arena.
+    static constexpr int local_numa_node = -2;
+
+    /**
+     * @brief NUMA node to bind the initial buffer's pages to (Linux only).
+     *
+     * Any value other than no_numa_node backs the initial buffer with
+     * mapped memory and binds it with mbind(MPOL_BIND), so workers on that
+     * node never pay remote-memory latency for it. Where binding is not
+     * supported the buffer keeps the default policy; Arena::numa_node()
+     * reports the result. Chained blocks come from upstream: use
+     * arena::node_block_pool() to keep them on the node too.
+     */
+    int numa_node = no_numa_node;
+
+    /**
+     * @brief Where requests go once the arena cannot serve them.
+     *
+     * nullptr keeps the default: try_allocate() returns nullptr and
+     * allocate() throws std::bad_alloc. Otherwise a request that does not
+     * fit (and cannot be chained or committed) is forwarded here instead:
+     * std::pmr::new_delete_resource() for the heap, or an arena::Resource
+     * to spill into another arena. Overflow allocations are recorded in the
+     * arena and given back by reset(), by a rewind() to a mark taken before
+     * them, and by the destructor, so the bump path stays the common case
+     * and a rare oversize request never fails. The resource must outlive
+     * the arena.
+     */
+    std::pmr::memory_resource *overflow = nullptr;
+
+    /**
+     * @brief Size chained blocks from min_block_size alone.
+     *
+     * By default a new block is (current block size * growth_factor), so
+     * one oversized allocation inflates every block chained after it. When
+     * set, each block is max(min_block_size, bytes needed) whatever the
+     * previous one was; arena::Lease relies on this to keep its sub-chunks
+     * at the lease size.
+     */
+    bool fixed_block_size = false;
+  };
+
+  class SubArena;
+
   /**
    * @brief A fast bump-pointer arena allocator.
    *
-   * This arena allocates memory linearly from a fixed-size buffer.
-   * Individual frees are not supported; instead you can:
+   * This arena allocates memory linearly from a fixed-size buffer, or from a
+   * chain of blocks when constructed with Options::growth_factor.
+   * Only the most recent allocation can be freed individually (deallocate());
+   * otherwise you can:
    * - reset() the whole arena at once
    * - use Mark + rewind() for checkpoints
    * - use Scope for RAII-based temporary allocations (mark/rewind)
    *
    * @note This allocator is not thread-safe.
-   * @note This arena does not call destructors automatically for objects
-   *       created with make()/make_array(). Use it for temporary lifetimes
-   *       or types that don't require destruction, or manage destruction yourself.
+   * @note By default this arena does not call destructors automatically for
+   *       objects created with make()/make_array(). Use it for temporary
+   *       lifetimes or types that don't require destruction, manage
+   *       destruction yourself, or enable Options::track_destructors.
    */
   class Arena final
   {
@@ -32,9 +235,76 @@ namespace arena
     /**
      * @brief Construct an arena with a fixed byte capacity.
      * @param capacity_bytes Total bytes available for allocations.
+     *
+     * The buffer is not zero-initialized.
      */
     explicit Arena(std::size_t capacity_bytes)
-        : buffer_(capacity_bytes), offset_(0)
+        : Arena(capacity_bytes, Options{})
+    {
+    }
+
+    /**
+     * @brief Construct an arena with an initial byte capacity and options.
+     * @param capacity_bytes Bytes available in the initial buffer (bytes
+     *        committed up front when Options::reserve_bytes is set).
+     * @param options Growth, backing store and block caching policy.
+     * @throws std::bad_alloc If the initial buffer cannot be obtained.
+     */
+    Arena(std::size_t capacity_bytes, const Options &options)
+        : options_(options)
+    {
+      if (options_.huge_pages != HugePages::none)
+        map_huge_buffer(capacity_bytes);
+      else if (options_.reserve_bytes != 0 || (options_.numa_node != Options::no_numa_node && capacity_bytes != 0))
+        map_buffer(capacity_bytes, 0);
+      else if (capacity_bytes != 0)
+      {
+        buffer_ = new byte[capacity_bytes];
+        capacity_ = capacity_bytes;
+        committed_ = capacity_bytes;
+      }
+
+      base_ = buffer_;
+      limit_ = committed_;
+
+      if (mapped() && options_.numa_node != Options::no_numa_node)
+        bind_numa();
+      if (options_.prefault)
+        prefault();
+      detail::poison_region(buffer_, committed_);
+    }
+
+    /**
+     * @brief Construct a non-owning arena over an external buffer.
+     * @param buffer Memory to bump-allocate from (stack memory, a shared
+     *        memory segment, a slice of a larger slab, ...). It must outlive
+     *        the arena and is never freed by it.
+     * @param options Growth and block caching policy. Chained blocks, if
+     *        any, come from the heap. Backing store options
+     *        (reserve_bytes, huge_pages) are ignored.
+     */
+    explicit Arena(std::span<byte> buffer, const Options &options = Options{}) noexcept
+        : buffer_(buffer.data()),
+          capacity_(buffer.size()),
+          committed_(buffer.size()),
+          storage_(Storage::external),
+          base_(buffer.data()),
+          limit_(buffer.size()),
+          options_(options)
+    {
+      if (options_.prefault)
+        prefault();
+      detail::poison_region(buffer_, committed_);
+    }
+
+    /**
+     * @brief Construct a non-owning arena over an external buffer.
+     * @param data Start of the buffer.
+     * @param size Size of the buffer in bytes.
+     * @param options Growth and block caching policy.
+     */
+    Arena(void *data, std::size_t size, const Options &options = Options{}) noexcept
+        : Arena(std::span<byte>(static_cast<byte *>(data), size), options)
     {
     }
 
@@ -48,11 +318,7 @@ namespace arena
      * @brief Move-construct an arena.
      * @note Any pointers obtained from the moved-from arena become invalid.
      */
-    Arena(Arena &&other) noexcept
-        : buffer_(std::move(other.buffer_)), offset_(other.offset_)
-    {
-      other.offset_ = 0;
-    }
+    Arena(Arena &&other) noexcept { steal(other); }
 
     /**
      * @brief Move-assign an arena.
@@ -62,42 +328,210 @@ namespace arena
     {
       if (this != &other)
       {
-        buffer_ = std::move(other.buffer_);
-        offset_ = other.offset_;
-        other.offset_ = 0;
+        release();
+        steal(other);
       }
       return *this;
     }
 
+    /// @brief Release the initial buffer and every chained block.
+    ~Arena() { release(); }
+
     /**
      * @brief Reset the arena to empty (all allocations become invalid).
      *
-     * This is O(1).
+     * This is O(1) for a fixed-size arena. In growable mode, chained blocks
+     * are kept for reuse (see Options::cache_blocks), so steady-state
+     * workloads stop touching the system allocator. Overflow allocations
+     * are returned to Options::overflow.
+     */
+    void reset() noexcept
+    {
+      if (finalizers_)
+        run_finalizers(nullptr);
+
+      while (head_)
+        pop_block(true);
+      free_overflow(0);
+      detail::poison_region(base_, offset_);
+      offset_ = 0;
+      note_reset();
+
+      if (!options_.cache_blocks)
+        free_spares(largest_spare());
+
+      if (reserved())
+        decommit_tail();
+    }
+
+    /**
+     * @brief Free every cached chained block.
+     *
+     * Blocks currently holding allocations are not affected.
      */
-    void reset() noexcept { offset_ = 0; }
+    void trim() noexcept { free_spares(nullptr); }
 
-    /// @return Total capacity in bytes.
-    [[nodiscard]] std::size_t capacity() const noexcept { return buffer_.size(); }
+    /**
+     * @return Total capacity in bytes.
+     *
+     * In growable mode this is the size of every block that currently holds
+     * allocations (cached blocks are not counted). For a reserved arena the
+     * whole reservation counts, committed or not.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept { return chain_capacity_ + current_capacity(); }
 
     /// @return Number of bytes currently used.
-    [[nodiscard]] std::size_t used() const noexcept { return offset_; }
+    [[nodiscard]] std::size_t used() const noexcept { return chain_used_ + offset_; }
 
-    /// @return Remaining capacity in bytes.
-    [[nodiscard]] std::size_t remaining() const noexcept { return capacity() - used(); }
+    /**
+     * @return Remaining capacity in bytes.
+     *
+     * In growable mode this is the space left in the current block, i.e. how
+     * much can be allocated before a new block is chained.
+     */
+    [[nodiscard]] std::size_t remaining() const noexcept { return current_capacity() - offset_; }
 
     /// @return True if no bytes are currently allocated.
-    [[nodiscard]] bool empty() const noexcept { return offset_ == 0; }
+    [[nodiscard]] bool empty() const noexcept { return used() == 0; }
+
+    /// @return True if the arena chains new blocks when it runs out of space.
+    [[nodiscard]] bool growable() const noexcept { return options_.growth_factor != 0.0; }
+
+    /// @return True if make()/make_array() register destructors (Options::track_destructors).
+    [[nodiscard]] bool tracks_destructors() const noexcept { return options_.track_destructors; }
+
+    /**
+     * @return True if the initial buffer is a reserved virtual memory range
+     *         committed on demand (Options::reserve_bytes).
+     *
+     * Buffers mapped only for huge pages or NUMA binding are committed in
+     * full and are not reserved.
+     */
+    [[nodiscard]] bool reserved() const noexcept { return storage_ == Storage::reserved; }
+
+    /// @return NUMA node the initial buffer is bound to, or -1 if it is not bound.
+    [[nodiscard]] int numa_node() const noexcept { return numa_node_; }
+
+    /// @return True if the initial buffer is owned (and freed) by the arena.
+    [[nodiscard]] bool owning() const noexcept { return storage_ != Storage::external; }
+
+    /**
+     * @return Bytes of the initial buffer currently backed by memory.
+     *
+     * Equal to the initial capacity unless the arena is reserved().
+     */
+    [[nodiscard]] std::size_t committed() const noexcept { return committed_; }
+
+    /**
+     * @return Page size in bytes backing the initial buffer.
+     *
+     * For transparent huge pages this is the huge page size the buffer was
+     * aligned and advised for; the kernel may still back parts of it with
+     * regular pages.
+     */
+    [[nodiscard]] std::size_t page_size() const noexcept
+    {
+      return page_size_ ? page_size_ : detail::vm::page_size();
+    }
+
+    /// @return The kind of pages actually obtained for the initial buffer.
+    [[nodiscard]] HugePages huge_pages() const noexcept { return pages_; }
+
+    /**
+     * @return Bytes of bookkeeping in front of every chained block.
+     *
+     * A chained block of n usable bytes costs n + block_overhead() bytes
+     * from Options::upstream.
+     */
+    [[nodiscard]] static constexpr std::size_t block_overhead() noexcept { return sizeof(Block); }
+
+    /// @return Number of blocks holding allocations (the initial buffer counts as one).
+    [[nodiscard]] std::size_t block_count() const noexcept
+    {
+      std::size_t n = 1;
+      for (const Block *b = head_; b; b = b->prev)
+        ++n;
+      return n;
+    }
+
+    /// @return Bytes currently held by overflow allocations (Options::overflow).
+    [[nodiscard]] std::size_t overflow_bytes() const noexcept
+    {
+      std::size_t n = 0;
+      for (const Overflow *o = overflow_; o; o = o->prev)
+        n += o->size;
+      return n;
+    }
+
+    /**
+     * @return The bytes [0, used()) of the initial buffer, or an empty span
+     *         once blocks are chained (the contents are then not contiguous).
+     *
+     * Offsets into this span are stable for the arena's lifetime, which is
+     * what save_snapshot() writes out.
+     */
+    [[nodiscard]] std::span<const std::byte> contents() const noexcept
+    {
+      if (head_ || !buffer_)
+        return {};
+      return {buffer_, offset_};
+    }
+
+    /**
+     * @return The whole initial buffer, [0, capacity) before any block is
+     *         chained (the reserved range for reserved arenas).
+     *
+     * Its start is the base that arena::Ref offsets are relative to.
+     */
+    [[nodiscard]] std::span<std::byte> buffer() noexcept { return {buffer_, capacity_}; }
+    [[nodiscard]] std::span<const std::byte> buffer() const noexcept { return {buffer_, capacity_}; }
+
+    /// @brief True when the library was built with ARENA_ENABLE_STATS.
+    static constexpr bool stats_enabled = ARENA_ENABLE_STATS != 0;
+
+    /// @brief True when the library was built with ARENA_ENABLE_POISONING.
+    static constexpr bool poisoning_enabled = ARENA_ENABLE_POISONING != 0;
+
+    /// @brief Poisoned bytes reserved after every allocation (0 unless poisoning is on).
+    static constexpr std::size_t redzone_size = detail::redzone_size;
+
+    /**
+     * @return A snapshot of the allocation statistics.
+     *
+     * All fields are zero unless ARENA_ENABLE_STATS is set.
+     */
+    [[nodiscard]] Stats stats() const noexcept
+    {
+#if ARENA_ENABLE_STATS
+      Stats s = stats_;
+      s.blocks = block_count();
+      return s;
+#else
+      return {};
+#endif
+    }
+
+    /// @brief Clear the counters and restart peak tracking from used().
+    void reset_stats() noexcept
+    {
+#if ARENA_ENABLE_STATS
+      stats_ = Stats{};
+      stats_.peak_used = used();
+#endif
+    }
 
     /**
      * @brief Allocate a raw memory block with alignment.
      * @param size Requested size in bytes (0 will be treated as 1).
      * @param alignment Requested alignment (must be a power of two).
+     * @param site Call site recorded when ARENA_ENABLE_TRACING is set.
      * @return Pointer to the allocated block.
      * @throws std::bad_alloc If there is not enough space or alignment is invalid.
      */
-    [[nodiscard]] void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    [[nodiscard]] void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t),
+                                 CallSite site = CallSite::current())
     {
-      void *p = try_allocate(size, alignment);
+      void *p = try_allocate(size, alignment, site);
       if (!p)
         throw std::bad_alloc{};
       return p;
@@ -107,130 +541,596 @@ namespace arena
      * @brief Try to allocate a raw memory block with alignment.
      * @param size Requested size in bytes (0 will be treated as 1).
      * @param alignment Requested alignment (must be a power of two).
+     * @param site Call site recorded when ARENA_ENABLE_TRACING is set.
      * @return Pointer to the allocated block, or nullptr on failure.
      *
      * Failure happens if:
      * - alignment is not a power of two
-     * - the arena does not have enough remaining space
+     * - the arena does not have enough remaining space and is not growable
+     * - a new block could not be obtained from the system allocator
+     * and Options::overflow is unset or fails as well.
      */
-    [[nodiscard]] void *try_allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept
+    [[nodiscard]] void *try_allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t),
+                                     [[maybe_unused]] CallSite site = CallSite::current()) noexcept
     {
       if (size == 0)
         size = 1;
 
       if (!is_power_of_two(alignment))
+      {
+        note_failure();
         return nullptr;
+      }
 
-      const std::size_t base = reinterpret_cast<std::size_t>(buffer_.data());
+      const std::size_t base = reinterpret_cast<std::size_t>(base_);
       const std::size_t current = base + offset_;
       const std::size_t aligned = align_up(current, alignment);
-      const std::size_t new_offset = (aligned - base) + size;
+      const std::size_t new_offset = (aligned - base) + size + redzone_size;
 
-      if (new_offset > buffer_.size())
-        return nullptr;
+      // size > limit_ also catches sizes that would wrap new_offset around.
+      if (size > limit_ || new_offset > limit_)
+      {
+        std::size_t padding;
+        void *p = allocate_slow(size, alignment, padding);
+        return trace(p, size, padding, site);
+      }
 
       offset_ = new_offset;
-      return reinterpret_cast<void *>(aligned);
+      note_allocation(aligned - current);
+      prefetch_ahead();
+      detail::unpoison_region(reinterpret_cast<void *>(aligned), size);
+      return trace(reinterpret_cast<void *>(aligned), size, aligned - current, site);
     }
 
     /**
-     * @brief Construct an object of type T inside the arena.
-     * @tparam T The object type to construct.
-     * @tparam Args Constructor argument types.
-     * @param args Constructor arguments forwarded to T's constructor.
-     * @return Pointer to the constructed object.
-     *
-     * @warning The object's destructor is NOT called automatically by Arena.
-     *          Use this only when the object lifetime is bounded by reset()/rewind(),
-     *          or when T is trivially destructible, or when you manually destroy it.
+     * @brief Allocate a raw memory block with a compile-time alignment.
+     * @tparam Alignment Requested alignment (must be a power of two).
+     * @param size Requested size in bytes (0 will be treated as 1).
+     * @param site Call site recorded when ARENA_ENABLE_TRACING is set.
+     * @return Pointer to the allocated block.
+     * @throws std::bad_alloc If there is not enough space.
      */
-    template <class T, class... Args>
-    [[nodiscard]] T *make(Args &&...args)
+    template <std::size_t Alignment>
+    [[nodiscard]] void *allocate(std::size_t size, CallSite site = CallSite::current())
     {
-      static_assert(!std::is_void_v<T>, "T must not be void");
-      void *mem = allocate(sizeof(T), alignof(T));
-      return ::new (mem) T(std::forward<Args>(args)...);
+      void *p = try_allocate<Alignment>(size, site);
+      if (!p)
+        throw std::bad_alloc{};
+      return p;
     }
 
     /**
-     * @brief Allocate and default-construct an array of T in the arena.
-     * @tparam T The element type.
-     * @param count Number of elements.
-     * @return Pointer to the first element, or nullptr if count == 0.
-     *
-     * If T is trivially default constructible, elements are left uninitialized
-     * (fast path). Otherwise, each element is default-constructed.
+     * @brief Try to allocate a raw memory block with a compile-time alignment.
+     * @tparam Alignment Requested alignment (must be a power of two).
+     * @param size Requested size in bytes (0 will be treated as 1).
+     * @param site Call site recorded when ARENA_ENABLE_TRACING is set.
+     * @return Pointer to the allocated block, or nullptr on failure.
      *
-     * @warning Destructors are NOT called automatically by Arena.
+     * The alignment check happens at compile time and the align-up folds to
+     * constant masks (nothing at all for Alignment == 1), so the fast path
+     * is an add, a mask and a compare. make() and make_array() use this.
      */
-    template <class T>
-    [[nodiscard]] T *make_array(std::size_t count)
+    template <std::size_t Alignment>
+    [[nodiscard]] void *try_allocate(std::size_t size, [[maybe_unused]] CallSite site = CallSite::current()) noexcept
     {
-      static_assert(!std::is_void_v<T>, "T must not be void");
-      if (count == 0)
+      static_assert(is_power_of_two(Alignment), "Alignment must be a power of two");
+
+      if (size == 0)
+        size = 1;
+
+      const std::size_t base = reinterpret_cast<std::size_t>(base_);
+      const std::size_t current = base + offset_;
+      std::size_t aligned = current;
+      if constexpr (Alignment > 1)
+        aligned = (aligned + (Alignment - 1)) & ~(Alignment - 1);
+      const std::size_t new_offset = (aligned - base) + size + redzone_size;
+
+      if (size > limit_ || new_offset > limit_) [[unlikely]]
+      {
+        std::size_t padding;
+        void *p = allocate_slow(size, Alignment, padding);
+        return trace(p, size, padding, site);
+      }
+
+      offset_ = new_offset;
+      note_allocation(aligned - current);
+      prefetch_ahead();
+      detail::unpoison_region(reinterpret_cast<void *>(aligned), size);
+      return trace(reinterpret_cast<void *>(aligned), size, aligned - current, site);
+    }
+
+    /**
+     * @brief Allocate count same-sized blocks with one bounds check and one bump.
+     * @param count Number of blocks.
+     * @param size Size of each block in bytes (0 will be treated as 1).
+     * @param alignment Alignment of each block (must be a power of two).
+     * @return Pointer to the first block; block i starts at
+     *         i * align_up(size, alignment) bytes from it. nullptr on failure
+     *         or if count == 0.
+     */
+    [[nodiscard]] void *try_allocate_n(std::size_t count, std::size_t size,
+                                       std::size_t alignment = alignof(std::max_align_t),
+                                       CallSite site = CallSite::current()) noexcept
+    {
+      if (count == 0 || !is_power_of_two(alignment))
+      {
+        note_failure();
         return nullptr;
+      }
 
-      void *mem = allocate(sizeof(T) * count, alignof(T));
-      T *ptr = static_cast<T *>(mem);
+      if (size == 0)
+        size = 1;
 
-      if constexpr (std::is_trivially_default_constructible_v<T>)
+      if (size > std::numeric_limits<std::size_t>::max() - alignment)
       {
-        return ptr;
+        note_failure();
+        return nullptr;
       }
-      else
+
+      const std::size_t stride = align_up(size, alignment);
+      if (count > std::numeric_limits<std::size_t>::max() / stride)
       {
-        for (std::size_t i = 0; i < count; ++i)
-          ::new (static_cast<void *>(ptr + i)) T();
-        return ptr;
+        note_failure();
+        return nullptr;
       }
+
+      return try_allocate(stride * count, alignment, site);
     }
 
     /**
-     * @brief Check whether a pointer lies within the arena buffer.
-     * @param p Pointer to test.
-     * @return True if p is inside [buffer_begin, buffer_end).
+     * @brief Allocate count same-sized blocks with one bounds check and one bump.
+     * @return Pointer to the first block.
+     * @throws std::bad_alloc If there is not enough space, count == 0 or
+     *         alignment is invalid.
+     * @see try_allocate_n()
      */
-    [[nodiscard]] bool owns(const void *p) const noexcept
+    [[nodiscard]] void *allocate_n(std::size_t count, std::size_t size,
+                                   std::size_t alignment = alignof(std::max_align_t),
+                                   CallSite site = CallSite::current())
     {
-      const auto *b = reinterpret_cast<const std::uint8_t *>(buffer_.data());
-      const auto *e = b + buffer_.size();
-      const auto *x = reinterpret_cast<const std::uint8_t *>(p);
-      return x >= b && x < e;
+      void *p = try_allocate_n(count, size, alignment, site);
+      if (!p)
+        throw std::bad_alloc{};
+      return p;
     }
 
     /**
-     * @brief A checkpoint representing the current allocation offset.
+     * @brief Grow or shrink an allocation in place.
+     * @param p Block returned by allocate()/try_allocate().
+     * @param old_size Size p was allocated (or last resized) with.
+     * @param new_size Requested size in bytes. 0 releases the block.
+     * @return True if p now holds new_size bytes, false if nothing changed.
      *
-     * Use mark() to capture a checkpoint, and rewind() to restore it.
+     * Succeeds only when p is the most recent allocation, i.e. it ends at
+     * the current offset, and the current block has room for new_size.
+     * This makes repeated appends to the last allocation O(1) with no copy.
+     * Shrinking fails while p holds an object (or destructor record) that
+     * Options::track_destructors registered: its destructor still has to run.
      */
-    struct Mark
+    [[nodiscard]] bool try_resize(void *p, std::size_t old_size, std::size_t new_size) noexcept
     {
-      /// @brief Saved offset in bytes.
-      std::size_t offset = 0;
-    };
+      if (!p)
+        return false;
 
-    /**
-     * @brief Capture the current arena offset.
-     * @return A Mark that can be used with rewind().
-     */
-    [[nodiscard]] Mark mark() const noexcept { return Mark{offset_}; }
+      if (old_size == 0)
+        old_size = 1;
+
+      const std::size_t base = reinterpret_cast<std::size_t>(base_);
+      const std::size_t end = reinterpret_cast<std::size_t>(p) + old_size + redzone_size;
+      if (end != base + offset_ || old_size + redzone_size > offset_)
+        return false;
+
+      if (new_size > std::numeric_limits<std::size_t>::max() - redzone_size)
+        return false;
+
+      if (new_size < old_size && finalizer_at_or_after(p))
+        return false;
+
+      // Releasing the allocation drops its redzone too.
+      const std::size_t start = offset_ - old_size - redzone_size;
+      const std::size_t span = new_size == 0 ? 0 : new_size + redzone_size;
+      if (span > limit_ - start)
+      {
+        if (!reserved() || head_ || span > capacity_ - start || !commit_to(start + span))
+          return false;
+      }
+
+      auto *bytes = static_cast<byte *>(p);
+      if (new_size > old_size)
+        detail::unpoison_region(bytes + old_size, new_size - old_size);
+      else
+        detail::poison_region(bytes + new_size, old_size - new_size);
+
+      offset_ = start + span;
+      note_usage();
+      return true;
+    }
 
     /**
-     * @brief Rewind the arena back to a previously captured mark.
-     * @param m The mark to restore.
-     *
-     * If m.offset is out of range, this function does nothing.
+     * @brief Resize an allocation, in place when possible.
+     * @param p Block to resize (nullptr behaves like try_allocate()).
+     * @param old_size Size p was allocated (or last resized) with.
+     * @param new_size Requested size in bytes (0 will be treated as 1).
+     * @param alignment Alignment p was allocated with.
+     * @return The resized block (p itself when resized in place or when
+     *         shrinking), or nullptr on failure, in which case p is untouched.
      *
-     * @note All allocations performed after the mark become invalid.
+     * When p is not the most recent allocation and has to grow, a new block
+     * is allocated and the first old_size bytes are copied into it. The old
+     * bytes stay dead until the arena is rewound or reset.
      */
-    void rewind(Mark m) noexcept
+    [[nodiscard]] void *try_reallocate(void *p, std::size_t old_size, std::size_t new_size,
+                                       std::size_t alignment = alignof(std::max_align_t)) noexcept
     {
-      if (m.offset <= buffer_.size())
-        offset_ = m.offset;
+      if (!p)
+        return try_allocate(new_size, alignment);
+
+      if (new_size == 0)
+        new_size = 1;
+
+      if (try_resize(p, old_size, new_size) || new_size <= old_size)
+        return p;
+
+      void *q = try_allocate(new_size, alignment);
+      if (q)
+        std::memcpy(q, p, old_size);
+      return q;
     }
 
     /**
-     * @brief RAII helper that rewinds the arena when it goes out of scope.
+     * @brief Resize an allocation, in place when possible.
+     * @return The resized block.
+     * @throws std::bad_alloc If a larger block is needed and cannot be allocated.
+     * @see try_reallocate()
+     */
+    [[nodiscard]] void *reallocate(void *p, std::size_t old_size, std::size_t new_size,
+                                   std::size_t alignment = alignof(std::max_align_t))
+    {
+      void *q = try_reallocate(p, old_size, new_size, alignment);
+      if (!q)
+        throw std::bad_alloc{};
+      return q;
+    }
+
+    /**
+     * @brief Give back an allocation if it is the most recent one.
+     * @param p Block returned by allocate()/try_allocate() (nullptr is ignored).
+     * @param size Size p was allocated (or last resized) with.
+     * @return True if the bytes were reclaimed, false if p is not on top
+     *         (its bytes then come back on the next rewind() or reset()).
+     *
+     * Used by the allocator adapters, which cannot know whether frees
+     * arrive in order. Equivalent to try_resize(p, size, 0), except that the
+     * most recent overflow allocation (Options::overflow) is given back to
+     * its resource right away.
+     */
+    bool try_deallocate(void *p, std::size_t size) noexcept
+    {
+      if (try_resize(p, size, 0))
+        return true;
+      if (!overflow_ || !p || p != data(overflow_))
+        return false;
+      free_overflow(overflow_->index);
+      return true;
+    }
+
+    /**
+     * @brief Free the most recent allocation, stack style.
+     * @param p Block returned by allocate()/try_allocate() (nullptr is ignored).
+     * @param size Size p was allocated (or last resized) with.
+     *
+     * Strictly nested temporaries can free themselves in reverse order and
+     * keep used() (and the peak) low without a Mark at every call site:
+     *
+     * @code
+     * auto* a = arena.allocate(n, 16);
+     * auto* b = arena.allocate(m, 16);
+     * arena.deallocate(b, m);
+     * arena.deallocate(a, n); // used() is back where it started
+     * @endcode
+     *
+     * Alignment padding in front of a block is not reclaimed with it; use
+     * sizes that are multiples of the next allocation's alignment when
+     * frees must unwind all the way.
+     *
+     * Objects whose destructor Options::track_destructors registered are
+     * never reclaimed this way (their destructor runs on rewind() or
+     * reset()), and count as out-of-order frees.
+     *
+     * With ARENA_ENABLE_LIFO_CHECKS, freeing anything other than the most
+     * recent allocation asserts; otherwise it is a no-op.
+     */
+    void deallocate(void *p, std::size_t size) noexcept
+    {
+      [[maybe_unused]] const bool reclaimed = try_deallocate(p, size);
+#if ARENA_ENABLE_LIFO_CHECKS
+      assert((reclaimed || !p) && "Arena::deallocate: not the most recent allocation (non-LIFO free)");
+#endif
+    }
+
+    /**
+     * @brief Construct an object of type T inside the arena.
+     * @tparam T The object type to construct.
+     * @tparam Args Constructor argument types.
+     * @param args Constructor arguments forwarded to T's constructor.
+     * @return Pointer to the constructed object.
+     *
+     * make() is variadic and cannot capture its caller with a default
+     * argument: with ARENA_ENABLE_TRACING its events carry make()'s own
+     * location. Use make_at() where the call site matters.
+     *
+     * @warning Unless Options::track_destructors is set, the object's
+     *          destructor is NOT called automatically by Arena. Use this only
+     *          when the object lifetime is bounded by reset()/rewind(), or when
+     *          T is trivially destructible, or when you manually destroy it.
+     */
+    template <class T, class... Args>
+    [[nodiscard]] T *make(Args &&...args)
+    {
+      return make_at<T>(CallSite::current(), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief make() that records an explicit call site.
+     * @param site Call site recorded when ARENA_ENABLE_TRACING is set,
+     *        normally arena::CallSite::current().
+     * @param args Constructor arguments forwarded to T's constructor.
+     * @return Pointer to the constructed object.
+     *
+     * @code
+     * Node* n = a.make_at<Node>(arena::CallSite::current(), key);
+     * @endcode
+     */
+    template <class T, class... Args>
+    [[nodiscard]] T *make_at(CallSite site, Args &&...args)
+    {
+      static_assert(!std::is_void_v<T>, "T must not be void");
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        if (options_.track_destructors)
+        {
+          void *record = allocate<alignof(Finalizer)>(sizeof(Finalizer), site);
+          T *obj = ::new (allocate<alignof(T)>(sizeof(T), site)) T(std::forward<Args>(args)...);
+          push_finalizer(record, &destroy_n<T>, obj, 1);
+          return obj;
+        }
+      }
+
+      void *mem = allocate<alignof(T)>(sizeof(T), site);
+      return ::new (mem) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Allocate and default-construct an array of T in the arena.
+     * @tparam T The element type.
+     * @param count Number of elements.
+     * @param site Call site recorded when ARENA_ENABLE_TRACING is set.
+     * @return Pointer to the first element, or nullptr if count == 0.
+     *
+     * If T is trivially default constructible, elements are left uninitialized
+     * (fast path). Otherwise, each element is default-constructed.
+     *
+     * @warning Unless Options::track_destructors is set, destructors are NOT
+     *          called automatically by Arena.
+     */
+    template <class T>
+    [[nodiscard]] T *make_array(std::size_t count, CallSite site = CallSite::current())
+    {
+      static_assert(!std::is_void_v<T>, "T must not be void");
+      if (count == 0)
+        return nullptr;
+
+      if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        throw std::bad_alloc{};
+
+      return construct_array<T, alignof(T)>(count, sizeof(T) * count, site);
+    }
+
+    /**
+     * @brief Allocate an array of T on its own cache lines, for SIMD loops.
+     * @tparam T The element type.
+     * @tparam Alignment Start alignment (at least alignof(T); 64 matches a
+     *         cache line and AVX-512 vectors).
+     * @param count Number of elements.
+     * @param site Call site recorded when ARENA_ENABLE_TRACING is set.
+     * @return Pointer to the first element, or nullptr if count == 0.
+     *
+     * The allocated size is rounded up to a multiple of Alignment, so the
+     * next allocation starts on a fresh line: arrays written by different
+     * threads never share a cache line, and vector loops can run over the
+     * padded tail without touching a neighbour. Elements are initialized
+     * as with make_array().
+     */
+    template <class T, std::size_t Alignment = cache_line_size>
+    [[nodiscard]] T *make_array_aligned(std::size_t count, CallSite site = CallSite::current())
+    {
+      static_assert(!std::is_void_v<T>, "T must not be void");
+      static_assert(is_power_of_two(Alignment), "Alignment must be a power of two");
+      static_assert(Alignment >= alignof(T), "Alignment must be at least alignof(T)");
+      if (count == 0)
+        return nullptr;
+
+      if (count > (std::numeric_limits<std::size_t>::max() - (Alignment - 1)) / sizeof(T))
+        throw std::bad_alloc{};
+
+      const std::size_t bytes = (sizeof(T) * count + (Alignment - 1)) & ~(Alignment - 1);
+      return construct_array<T, Alignment>(count, bytes, site);
+    }
+
+    /**
+     * @brief Allocate and default-construct a batch of T in one bump.
+     * @param count Number of elements.
+     * @return The elements (empty if count == 0).
+     *
+     * Equivalent to make_array(), returned as a span.
+     */
+    template <class T>
+    [[nodiscard]] std::span<T> make_batch(std::size_t count)
+    {
+      return std::span<T>(make_array<T>(count), count);
+    }
+
+    /**
+     * @brief Allocate a batch of T in one bump and construct each element
+     *        from a generator.
+     * @param count Number of elements.
+     * @param gen Callable invoked as gen(i) for i in [0, count); element i
+     *        is constructed from its result. Works for types that are not
+     *        default-constructible.
+     * @return The elements (empty if count == 0).
+     *
+     * If gen or a constructor throws, the elements built so far are
+     * destroyed before the exception propagates.
+     */
+    template <class T, class Gen>
+    [[nodiscard]] std::span<T> make_batch(std::size_t count, Gen &&gen)
+    {
+      static_assert(!std::is_void_v<T>, "T must not be void");
+      static_assert(std::is_invocable_v<Gen &, std::size_t>, "gen must be callable with an index");
+      if (count == 0)
+        return {};
+
+      void *record = nullptr;
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        if (options_.track_destructors)
+          record = allocate<alignof(Finalizer)>(sizeof(Finalizer));
+      }
+
+      T *ptr = static_cast<T *>(allocate_n(count, sizeof(T), alignof(T)));
+      std::size_t i = 0;
+      try
+      {
+        for (; i < count; ++i)
+          ::new (static_cast<void *>(ptr + i)) T(gen(i));
+      }
+      catch (...)
+      {
+        destroy_n<T>(ptr, i);
+        throw;
+      }
+
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        if (record)
+          push_finalizer(record, &destroy_n<T>, ptr, count);
+      }
+      return std::span<T>(ptr, count);
+    }
+
+    /**
+     * @brief Carve a child arena out of this one.
+     * @param bytes Size of the child's buffer.
+     * @param options Growth and block caching policy for the child.
+     * @return An independent arena over bytes bytes of this arena.
+     * @throws std::bad_alloc If this arena cannot provide the bytes.
+     * @see SubArena
+     */
+    [[nodiscard]] SubArena child(std::size_t bytes, const Options &options = Options{});
+
+    /**
+     * @brief Check whether a pointer lies within the arena buffer.
+     * @param p Pointer to test.
+     * @return True if p is inside [buffer_begin, buffer_end), inside one of
+     *         the chained blocks currently holding allocations or inside a
+     *         live overflow allocation (Options::overflow).
+     */
+    [[nodiscard]] bool owns(const void *p) const noexcept
+    {
+      if (in_range(p, buffer_, capacity_))
+        return true;
+
+      for (const Block *b = head_; b; b = b->prev)
+      {
+        if (in_range(p, data(b), b->size))
+          return true;
+      }
+
+      for (const Overflow *o = overflow_; o; o = o->prev)
+      {
+        if (in_range(p, data(o), o->size))
+          return true;
+      }
+      return false;
+    }
+
+    /**
+     * @brief A checkpoint representing the current allocation offset.
+     *
+     * Use mark() to capture a checkpoint, and rewind() to restore it.
+     */
+    struct Mark
+    {
+      /// @brief Saved offset in bytes, relative to the start of the block.
+      std::size_t offset = 0;
+
+      /// @brief Opaque block identifier (nullptr for the initial buffer).
+      const void *block = nullptr;
+
+      /// @brief Opaque destructor list position (see Options::track_destructors).
+      const void *finalizer = nullptr;
+
+      /// @brief Overflow allocations made before the mark (see Options::overflow).
+      std::size_t overflow = 0;
+    };
+
+    /**
+     * @brief Capture the current arena offset.
+     * @return A Mark that can be used with rewind().
+     */
+    [[nodiscard]] Mark mark() const noexcept { return Mark{offset_, head_, finalizers_, overflow_count_}; }
+
+    /**
+     * @brief Rewind the arena back to a previously captured mark.
+     * @param m The mark to restore.
+     *
+     * If m does not refer to a block currently in use, or m.offset is out of
+     * range for that block, this function does nothing.
+     * Tracked destructors registered after the mark run first, in LIFO
+     * order. Blocks chained after the mark are cached or freed according to
+     * Options::cache_blocks, overflow allocations made after the mark go
+     * back to Options::overflow, and a reserved arena decommits down to
+     * Options::decommit_threshold.
+     *
+     * @note All allocations performed after the mark become invalid.
+     */
+    void rewind(Mark m) noexcept
+    {
+      if (m.block == head_)
+      {
+        if (m.offset > limit_)
+          return;
+
+        if (finalizers_ != m.finalizer)
+          run_finalizers(static_cast<const Finalizer *>(m.finalizer));
+        if (offset_ > m.offset)
+          detail::poison_region(base_ + m.offset, offset_ - m.offset);
+        offset_ = m.offset;
+      }
+      else
+      {
+        const auto *target = static_cast<const Block *>(m.block);
+        if (!in_chain(target) || m.offset > block_size(target))
+          return;
+
+        if (finalizers_ != m.finalizer)
+          run_finalizers(static_cast<const Finalizer *>(m.finalizer));
+
+        while (head_ && head_ != m.block)
+          pop_block(options_.cache_blocks);
+        if (offset_ > m.offset)
+          detail::poison_region(base_ + m.offset, offset_ - m.offset);
+        offset_ = m.offset;
+      }
+      free_overflow(m.overflow);
+      note_rewind();
+
+      if (reserved())
+        decommit_tail();
+    }
+
+    /**
+     * @brief RAII helper that rewinds the arena when it goes out of scope.
      *
      * Typical usage:
      * @code
@@ -296,25 +1196,956 @@ namespace arena
 
   private:
     /**
-     * @brief Return true if x is a power of two.
+     * @brief Where the initial buffer comes from.
      */
-    static constexpr bool is_power_of_two(std::size_t x) noexcept
+    enum class Storage : unsigned char
     {
-      return x != 0 && (x & (x - 1)) == 0;
+      heap,
+      /// @brief Mapped and committed in full (huge pages, NUMA binding).
+      mapped,
+      /// @brief Mapped and committed on demand (Options::reserve_bytes).
+      reserved,
+      external,
+    };
+
+    /// @return True if the initial buffer was mapped with detail::vm.
+    [[nodiscard]] bool mapped() const noexcept
+    {
+      return storage_ == Storage::mapped || storage_ == Storage::reserved;
     }
 
     /**
-     * @brief Align value up to the next multiple of alignment.
-     * @param value Value to align.
-     * @param alignment Power-of-two alignment.
-     * @return Aligned value.
+     * @brief Header placed in front of every chained block.
      */
-    static constexpr std::size_t align_up(std::size_t value, std::size_t alignment) noexcept
+    struct alignas(std::max_align_t) Block
     {
-      return (value + (alignment - 1)) & ~(alignment - 1);
+      /// @brief Previous block in the chain (or next cached block).
+      Block *prev;
+
+      /// @brief Usable bytes after the header.
+      std::size_t size;
+
+      /// @brief Offset in the previous block when this block was chained.
+      std::size_t saved_offset;
+    };
+
+    /**
+     * @brief Header placed in front of every overflow allocation.
+     */
+    struct alignas(std::max_align_t) Overflow
+    {
+      /// @brief Previous overflow allocation (older).
+      Overflow *prev;
+
+      /// @brief Value of overflow_count_ when this allocation was made.
+      std::size_t index;
+
+      /// @brief Requested size of the allocation.
+      std::size_t size;
+
+      /// @brief Bytes and alignment obtained from Options::overflow.
+      std::size_t bytes;
+      std::size_t alignment;
+    };
+
+    /**
+     * @brief Destructor record stored in the arena (Options::track_destructors).
+     */
+    struct Finalizer
+    {
+      Finalizer *prev;
+      void (*destroy)(void *, std::size_t) noexcept;
+      void *object;
+      std::size_t count;
+    };
+
+    template <class T>
+    static void destroy_n(void *p, std::size_t count) noexcept
+    {
+      T *objects = static_cast<T *>(p);
+      while (count != 0)
+        objects[--count].~T();
     }
 
-    std::vector<byte> buffer_;
-    std::size_t offset_;
-  };
+    void push_finalizer(void *record, void (*destroy)(void *, std::size_t) noexcept, void *object,
+                        std::size_t count) noexcept
+    {
+      finalizers_ = ::new (record) Finalizer{finalizers_, destroy, object, count};
+    }
+
+    /// @brief Run tracked destructors, newest first, until the list reaches until.
+    void run_finalizers(const Finalizer *until) noexcept
+    {
+      while (finalizers_ && finalizers_ != until)
+      {
+        Finalizer *f = finalizers_;
+        finalizers_ = f->prev;
+        f->destroy(f->object, f->count);
+      }
+    }
+
+    /**
+     * @brief Return true if the newest destructor record, or the object it
+     *        destroys, lies in the current block at or after p.
+     *
+     * Records are pushed in allocation order, so the newest one is the
+     * highest in the block; if it is below p, every other one is too.
+     */
+    [[nodiscard]] bool finalizer_at_or_after(const void *p) const noexcept
+    {
+      if (!finalizers_)
+        return false;
+
+      const auto from = reinterpret_cast<std::uintptr_t>(p);
+      const auto top = reinterpret_cast<std::uintptr_t>(base_) + offset_;
+      const auto record = reinterpret_cast<std::uintptr_t>(finalizers_);
+      const auto object = reinterpret_cast<std::uintptr_t>(finalizers_->object);
+      return (record >= from && record < top) || (object >= from && object < top);
+    }
+
+    static byte *data(Block *b) noexcept { return reinterpret_cast<byte *>(b + 1); }
+
+    static const byte *data(const Block *b) noexcept { return reinterpret_cast<const byte *>(b + 1); }
+
+    static byte *data(Overflow *o) noexcept { return reinterpret_cast<byte *>(o) + overflow_header(o->alignment); }
+
+    static const byte *data(const Overflow *o) noexcept
+    {
+      return reinterpret_cast<const byte *>(o) + overflow_header(o->alignment);
+    }
+
+    /// @return Bytes from the start of an overflow allocation to its payload.
+    static constexpr std::size_t overflow_header(std::size_t alignment) noexcept
+    {
+      return align_up(sizeof(Overflow), alignment);
+    }
+
+    static bool in_range(const void *p, const byte *begin, std::size_t size) noexcept
+    {
+      const auto *b = reinterpret_cast<const std::uint8_t *>(begin);
+      const auto *e = b + size;
+      const auto *x = reinterpret_cast<const std::uint8_t *>(p);
+      return x >= b && x < e;
+    }
+
+    /**
+     * @brief Return true if target currently holds allocations.
+     * @param target Block to look up (nullptr for the initial buffer).
+     */
+    [[nodiscard]] bool in_chain(const Block *target) const noexcept
+    {
+      if (!target)
+        return true;
+
+      for (const Block *b = head_; b; b = b->prev)
+      {
+        if (b == target)
+          return true;
+      }
+      return false;
+    }
+
+    /// @return Usable size of a block in the chain (nullptr for the initial buffer).
+    [[nodiscard]] std::size_t block_size(const Block *target) const noexcept
+    {
+      return target ? target->size : capacity_;
+    }
+
+    /// @brief Shared body of make_array() and make_array_aligned().
+    template <class T, std::size_t Alignment>
+    [[nodiscard]] T *construct_array(std::size_t count, std::size_t bytes, CallSite site)
+    {
+      void *record = nullptr;
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        if (options_.track_destructors)
+          record = allocate<alignof(Finalizer)>(sizeof(Finalizer), site);
+      }
+
+      void *mem = allocate<Alignment>(bytes, site);
+      T *ptr = static_cast<T *>(mem);
+
+      if constexpr (!std::is_trivially_default_constructible_v<T>)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+          ::new (static_cast<void *>(ptr + i)) T();
+      }
+
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        if (record)
+          push_finalizer(record, &destroy_n<T>, ptr, count);
+      }
+      return ptr;
+    }
+
+    /// @return Capacity of the current block (the reservation for a reserved arena).
+    [[nodiscard]] std::size_t current_capacity() const noexcept
+    {
+      return head_ ? limit_ : capacity_;
+    }
+
+    /**
+     * @brief Slow path of try_allocate(): commit more of a reserved buffer,
+     *        or chain a block and allocate from it.
+     */
+    [[nodiscard]] void *grow_and_allocate(std::size_t size, std::size_t alignment) noexcept
+    {
+      if (reserved() && !head_)
+      {
+        if (void *p = commit_and_allocate(size, alignment))
+          return p;
+      }
+
+      if (!growable())
+        return nullptr;
+
+      if (size > std::numeric_limits<std::size_t>::max() - sizeof(Block) - alignment)
+        return nullptr;
+
+      const std::size_t needed = size + alignment - 1;
+      Block *b = take_spare(needed);
+      if (!b)
+      {
+        std::size_t bytes = next_block_size();
+        if (bytes < needed)
+          bytes = needed;
+
+        void *mem = allocate_block(bytes);
+        if (!mem)
+          return nullptr;
+        b = ::new (mem) Block{nullptr, bytes, 0};
+      }
+
+      push_block(b);
+
+      const std::size_t base = reinterpret_cast<std::size_t>(base_);
+      const std::size_t aligned = align_up(base, alignment);
+      offset_ = (aligned - base) + size;
+      return reinterpret_cast<void *>(aligned);
+    }
+
+    /**
+     * @brief Slow path of try_allocate(): chain or commit, recording stats.
+     * @param padding Set to the alignment padding skipped in the block the
+     *        allocation landed in (0 for an overflow allocation).
+     */
+    [[nodiscard]] void *allocate_slow(std::size_t size, std::size_t alignment, std::size_t &padding) noexcept
+    {
+      padding = 0;
+      if (size > std::numeric_limits<std::size_t>::max() - redzone_size)
+      {
+        note_failure();
+        return nullptr;
+      }
+
+      const byte *base = base_;
+      const std::size_t before = offset_;
+      void *p = grow_and_allocate(size + redzone_size, alignment);
+      if (!p)
+      {
+        if (options_.overflow)
+          return allocate_overflow(size, alignment);
+        note_failure();
+        return nullptr;
+      }
+
+      // A fresh block starts at offset 0; a commit continues from before.
+      const auto start = static_cast<std::size_t>(static_cast<byte *>(p) - base_);
+      padding = start - (base_ == base ? before : 0);
+      note_allocation(padding);
+      detail::unpoison_region(p, size);
+      return p;
+    }
+
+    /**
+     * @brief Serve a request the arena cannot hold from Options::overflow.
+     * @return The allocation, or nullptr if the resource failed as well.
+     */
+    [[nodiscard]] void *allocate_overflow(std::size_t size, std::size_t alignment) noexcept
+    {
+      const std::size_t align = alignment > alignof(Overflow) ? alignment : alignof(Overflow);
+      const std::size_t header = overflow_header(align);
+      if (size > std::numeric_limits<std::size_t>::max() - header)
+      {
+        note_failure();
+        return nullptr;
+      }
+
+      void *mem = nullptr;
+      try
+      {
+        mem = options_.overflow->allocate(header + size, align);
+      }
+      catch (...)
+      {
+        note_failure();
+        return nullptr;
+      }
+
+      overflow_ = ::new (mem) Overflow{overflow_, overflow_count_++, size, header + size, align};
+#if ARENA_ENABLE_STATS
+      ++stats_.allocations;
+      ++stats_.overflows;
+#endif
+      return data(overflow_);
+    }
+
+    /// @brief Give back every overflow allocation made at or after index.
+    void free_overflow(std::size_t index) noexcept
+    {
+      while (overflow_ && overflow_->index >= index)
+      {
+        Overflow *o = overflow_;
+        overflow_ = o->prev;
+        options_.overflow->deallocate(o, o->bytes, o->alignment);
+      }
+    }
+
+    void note_allocation([[maybe_unused]] std::size_t padding) noexcept
+    {
+#if ARENA_ENABLE_STATS
+      ++stats_.allocations;
+      stats_.padding_bytes += padding;
+      note_usage();
+#endif
+    }
+
+    void *trace(void *p, [[maybe_unused]] std::size_t size, [[maybe_unused]] std::size_t padding,
+                [[maybe_unused]] const CallSite &site) const noexcept
+    {
+#if ARENA_ENABLE_TRACING
+      if (p)
+      {
+        TraceEvent e;
+        e.arena = this;
+        e.file = site.file_name();
+        e.function = site.function_name();
+        e.line = static_cast<std::uint32_t>(site.line());
+        e.size = size;
+        e.padding = padding;
+        e.used = used();
+        TraceRing::global().record(e);
+      }
+#endif
+      return p;
+    }
+
+    void prefetch_ahead() const noexcept
+    {
+#if ARENA_PREFETCH_DISTANCE > 0 && (defined(__GNUC__) || defined(__clang__))
+      __builtin_prefetch(reinterpret_cast<const void *>(reinterpret_cast<std::uintptr_t>(base_) + offset_ +
+                                                        ARENA_PREFETCH_DISTANCE),
+                         1, 3);
+#endif
+    }
+
+    void note_usage() noexcept
+    {
+#if ARENA_ENABLE_STATS
+      const std::size_t u = used();
+      if (u > stats_.peak_used)
+        stats_.peak_used = u;
+#endif
+    }
+
+    void note_failure() noexcept
+    {
+#if ARENA_ENABLE_STATS
+      ++stats_.failed_allocations;
+#endif
+    }
+
+    void note_rewind() noexcept
+    {
+#if ARENA_ENABLE_STATS
+      ++stats_.rewinds;
+#endif
+    }
+
+    void note_reset() noexcept
+    {
+#if ARENA_ENABLE_STATS
+      ++stats_.resets;
+#endif
+    }
+
+    /**
+     * @brief Size of the next block to chain, from the current block size.
+     */
+    [[nodiscard]] std::size_t next_block_size() const noexcept
+    {
+      if (options_.fixed_block_size)
+        return options_.min_block_size;
+
+      // The reservation is address space, not a block size worth scaling.
+      const std::size_t current = !head_ && reserved() ? options_.min_block_size : current_capacity();
+      const double factor = options_.growth_factor < 1.0 ? 1.0 : options_.growth_factor;
+      const double scaled = static_cast<double>(current) * factor;
+      const double max = static_cast<double>(std::numeric_limits<std::size_t>::max() / 2);
+
+      std::size_t bytes = scaled >= max ? static_cast<std::size_t>(max) : static_cast<std::size_t>(scaled);
+      if (bytes < options_.min_block_size)
+        bytes = options_.min_block_size;
+      return bytes;
+    }
+
+    /**
+     * @brief Remove and return the first cached block of at least needed bytes.
+     */
+    [[nodiscard]] Block *take_spare(std::size_t needed) noexcept
+    {
+      for (Block **link = &spare_; *link; link = &(*link)->prev)
+      {
+        if ((*link)->size >= needed)
+        {
+          Block *b = *link;
+          *link = b->prev;
+          return b;
+        }
+      }
+      return nullptr;
+    }
+
+    /// @brief Make b the current block.
+    void push_block(Block *b) noexcept
+    {
+      b->prev = head_;
+      b->saved_offset = offset_;
+      chain_used_ += offset_;
+      chain_capacity_ += current_capacity();
+      detail::poison_region(data(b), b->size);
+
+      head_ = b;
+      base_ = data(b);
+      limit_ = b->size;
+      offset_ = 0;
+    }
+
+    /**
+     * @brief Drop the current block and make the previous one current.
+     * @param cache True to keep the block for reuse, false to free it.
+     */
+    void pop_block(bool cache) noexcept
+    {
+      Block *b = head_;
+      detail::poison_region(data(b), offset_);
+      head_ = b->prev;
+      base_ = head_ ? data(head_) : buffer_;
+      limit_ = head_ ? head_->size : committed_;
+      offset_ = b->saved_offset;
+      chain_used_ -= b->saved_offset;
+      chain_capacity_ -= current_capacity();
+
+      if (cache)
+      {
+        b->prev = spare_;
+        spare_ = b;
+      }
+      else
+      {
+        free_block(b);
+      }
+    }
+
+    /**
+     * @brief Get memory for a block of bytes usable bytes from the upstream.
+     * @return The memory, or nullptr on failure.
+     */
+    [[nodiscard]] void *allocate_block(std::size_t bytes) noexcept
+    {
+      if (!options_.upstream)
+        return ::operator new(sizeof(Block) + bytes, std::nothrow);
+
+      try
+      {
+        return options_.upstream->allocate(sizeof(Block) + bytes, alignof(Block));
+      }
+      catch (...)
+      {
+        return nullptr;
+      }
+    }
+
+    /// @brief Return a block to the upstream it came from.
+    void free_block(Block *b) noexcept
+    {
+      detail::unpoison_region(data(b), b->size);
+      if (!options_.upstream)
+        ::operator delete(b);
+      else
+        options_.upstream->deallocate(b, sizeof(Block) + b->size, alignof(Block));
+    }
+
+    /// @return The largest cached block, or nullptr if there is none.
+    [[nodiscard]] Block *largest_spare() const noexcept
+    {
+      Block *best = nullptr;
+      for (Block *b = spare_; b; b = b->prev)
+      {
+        if (!best || b->size > best->size)
+          best = b;
+      }
+      return best;
+    }
+
+    /// @brief Free every cached block except keep.
+    void free_spares(Block *keep) noexcept
+    {
+      while (spare_)
+      {
+        Block *b = spare_;
+        spare_ = b->prev;
+        if (b != keep)
+          free_block(b);
+      }
+
+      if (keep)
+      {
+        keep->prev = nullptr;
+        spare_ = keep;
+      }
+    }
+
+    /**
+     * @brief Reserve the initial buffer and commit its first bytes.
+     * @param commit_bytes Bytes to commit up front.
+     * @param alignment Alignment and size rounding of the range (0 for pages).
+     * @throws std::bad_alloc If the range cannot be reserved or committed.
+     */
+    void map_buffer(std::size_t commit_bytes, std::size_t alignment)
+    {
+      const std::size_t page = detail::vm::page_size();
+      const std::size_t round = alignment > page ? alignment : page;
+      const std::size_t want = options_.reserve_bytes > commit_bytes ? options_.reserve_bytes : commit_bytes;
+      if (want > std::numeric_limits<std::size_t>::max() - 2 * round)
+        throw std::bad_alloc{};
+
+      const std::size_t bytes = align_up(want, round);
+      void *p = detail::vm::reserve(bytes, round);
+      if (!p)
+        throw std::bad_alloc{};
+
+      const std::size_t initial = align_up(commit_bytes, page);
+      if (!detail::vm::commit(p, initial))
+      {
+        detail::vm::release(p, bytes);
+        throw std::bad_alloc{};
+      }
+
+      buffer_ = static_cast<byte *>(p);
+      capacity_ = bytes;
+      committed_ = initial;
+      storage_ = options_.reserve_bytes != 0 ? Storage::reserved : Storage::mapped;
+    }
+
+    /**
+     * @brief Map the initial buffer with the page size in Options::huge_pages,
+     *        falling back to smaller pages when it is unavailable.
+     * @param capacity_bytes Requested size (committed in full unless
+     *        Options::reserve_bytes is set).
+     * @throws std::bad_alloc If no memory can be mapped at all.
+     */
+    void map_huge_buffer(std::size_t capacity_bytes)
+    {
+      constexpr std::size_t huge_2mb = std::size_t{2} << 20;
+      constexpr std::size_t huge_1gb = std::size_t{1} << 30;
+
+      HugePages mode = options_.huge_pages;
+      if (options_.reserve_bytes != 0)
+        mode = HugePages::transparent;
+
+      const std::size_t want = capacity_bytes ? capacity_bytes : 1;
+      while (mode == HugePages::size_1gb || mode == HugePages::size_2mb)
+      {
+        const std::size_t page = mode == HugePages::size_1gb ? huge_1gb : huge_2mb;
+        if (want <= std::numeric_limits<std::size_t>::max() - page)
+        {
+          const std::size_t bytes = align_up(want, page);
+          if (void *p = detail::vm::map_huge(bytes, page))
+          {
+            buffer_ = static_cast<byte *>(p);
+            capacity_ = bytes;
+            committed_ = bytes;
+            storage_ = Storage::mapped;
+            page_size_ = page;
+            pages_ = mode;
+            return;
+          }
+        }
+        mode = mode == HugePages::size_1gb ? HugePages::size_2mb : HugePages::transparent;
+      }
+
+      // Commit the whole buffer up front unless reserving: partial commits
+      // split the mapping and keep the kernel from using huge pages.
+      if (options_.reserve_bytes == 0 && want > std::numeric_limits<std::size_t>::max() - huge_2mb)
+        throw std::bad_alloc{};
+      map_buffer(options_.reserve_bytes ? capacity_bytes : align_up(want, huge_2mb), huge_2mb);
+      if (detail::vm::advise_huge(buffer_, capacity_))
+      {
+        page_size_ = huge_2mb;
+        pages_ = HugePages::transparent;
+      }
+    }
+
+    /**
+     * @brief Commit enough of the reservation for an allocation and bump.
+     * @return The allocation, or nullptr if it does not fit the reservation.
+     */
+    [[nodiscard]] void *commit_and_allocate(std::size_t size, std::size_t alignment) noexcept
+    {
+      const std::size_t base = reinterpret_cast<std::size_t>(buffer_);
+      const std::size_t aligned = align_up(base + offset_, alignment);
+      const std::size_t new_offset = (aligned - base) + size;
+      if (size > capacity_ || new_offset > capacity_ || new_offset < offset_)
+        return nullptr;
+
+      if (!commit_to(new_offset))
+        return nullptr;
+
+      offset_ = new_offset;
+      return reinterpret_cast<void *>(aligned);
+    }
+
+    /**
+     * @brief Commit the reservation up to at least end bytes.
+     * @return False if end exceeds the reservation or the commit failed.
+     */
+    [[nodiscard]] bool commit_to(std::size_t end) noexcept
+    {
+      if (end > capacity_)
+        return false;
+      if (end <= committed_)
+        return true;
+
+      const std::size_t page = page_size();
+      const std::size_t chunk = align_up(options_.commit_granularity ? options_.commit_granularity : page, page);
+      std::size_t target = align_up(end, chunk);
+      if (target > capacity_ || target < end)
+        target = capacity_;
+
+      if (!detail::vm::commit(buffer_ + committed_, target - committed_))
+        return false;
+      detail::poison_region(buffer_ + committed_, target - committed_);
+
+      committed_ = target;
+      limit_ = target;
+      return true;
+    }
+
+    /**
+     * @brief Return committed pages past the current offset to the OS when
+     *        more than Options::decommit_threshold bytes would stay committed.
+     */
+    void decommit_tail() noexcept
+    {
+      if (head_ || committed_ <= options_.decommit_threshold)
+        return;
+
+      // Explicit huge pages are pinned for the lifetime of the arena.
+      if (pages_ == HugePages::size_2mb || pages_ == HugePages::size_1gb)
+        return;
+
+      const std::size_t page = page_size();
+      std::size_t keep = options_.decommit_threshold > offset_ ? options_.decommit_threshold : offset_;
+      keep = align_up(keep, page);
+      if (keep >= committed_)
+        return;
+
+      // Only committed memory stays poisoned; PROT_NONE guards the rest.
+      detail::unpoison_region(buffer_ + keep, committed_ - keep);
+      detail::vm::decommit(buffer_ + keep, committed_ - keep);
+      committed_ = keep;
+      limit_ = keep;
+    }
+
+    /// @brief Free every chained and cached block, then the initial buffer.
+    void release() noexcept
+    {
+      run_finalizers(nullptr);
+
+      while (head_)
+        pop_block(false);
+      free_spares(nullptr);
+      free_overflow(0);
+
+      // The memory may be reused by its owner or the system allocator.
+      detail::unpoison_region(buffer_, committed_);
+      if (mapped())
+        detail::vm::release(buffer_, capacity_);
+      else if (storage_ == Storage::heap)
+        delete[] buffer_;
+
+      buffer_ = nullptr;
+      base_ = nullptr;
+      capacity_ = 0;
+      committed_ = 0;
+      offset_ = 0;
+      limit_ = 0;
+      storage_ = Storage::heap;
+      page_size_ = 0;
+      pages_ = HugePages::none;
+      numa_node_ = -1;
+    }
+
+    /// @brief Take over the state of other and leave it empty and fixed-size.
+    void steal(Arena &other) noexcept
+    {
+      buffer_ = std::exchange(other.buffer_, nullptr);
+      capacity_ = std::exchange(other.capacity_, 0);
+      committed_ = std::exchange(other.committed_, 0);
+      storage_ = std::exchange(other.storage_, Storage::heap);
+      page_size_ = std::exchange(other.page_size_, 0);
+      pages_ = std::exchange(other.pages_, HugePages::none);
+      numa_node_ = std::exchange(other.numa_node_, -1);
+      base_ = std::exchange(other.base_, nullptr);
+      offset_ = std::exchange(other.offset_, 0);
+      limit_ = std::exchange(other.limit_, 0);
+      head_ = std::exchange(other.head_, nullptr);
+      spare_ = std::exchange(other.spare_, nullptr);
+      chain_used_ = std::exchange(other.chain_used_, 0);
+      chain_capacity_ = std::exchange(other.chain_capacity_, 0);
+      finalizers_ = std::exchange(other.finalizers_, nullptr);
+      overflow_ = std::exchange(other.overflow_, nullptr);
+      overflow_count_ = std::exchange(other.overflow_count_, 0);
+      options_ = other.options_;
+#if ARENA_ENABLE_STATS
+      stats_ = std::exchange(other.stats_, Stats{});
+#endif
+    }
+
+    /**
+     * @brief Bind the mapped initial buffer to Options::numa_node.
+     */
+    void bind_numa() noexcept
+    {
+      const int node = options_.numa_node == Options::local_numa_node ? detail::vm::current_numa_node()
+                                                                       : options_.numa_node;
+      if (node >= 0 && detail::vm::bind_to_node(buffer_, capacity_, node))
+        numa_node_ = node;
+    }
+
+    /**
+     * @brief Write one byte per committed page of the initial buffer.
+     */
+    void prefault() noexcept
+    {
+      // Transparent huge pages may still be backed by base pages, so only
+      // explicit huge pages can be touched once per huge page.
+      const bool explicit_huge = pages_ == HugePages::size_2mb || pages_ == HugePages::size_1gb;
+      const std::size_t page = explicit_huge ? page_size_ : detail::vm::page_size();
+      auto *p = reinterpret_cast<volatile unsigned char *>(buffer_);
+      for (std::size_t i = 0; i < committed_; i += page)
+        p[i] = 0;
+    }
+
+    /**
+     * @brief Return true if x is a power of two.
+     */
+    static constexpr bool is_power_of_two(std::size_t x) noexcept
+    {
+      return x != 0 && (x & (x - 1)) == 0;
+    }
+
+    /**
+     * @brief Align value up to the next multiple of alignment.
+     * @param value Value to align.
+     * @param alignment Power-of-two alignment.
+     * @return Aligned value.
+     */
+    static constexpr std::size_t align_up(std::size_t value, std::size_t alignment) noexcept
+    {
+      return (value + (alignment - 1)) & ~(alignment - 1);
+    }
+
+    byte *buffer_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t committed_ = 0;
+    Storage storage_ = Storage::heap;
+    HugePages pages_ = HugePages::none;
+    std::size_t page_size_ = 0;
+    int numa_node_ = -1;
+    byte *base_ = nullptr;
+    std::size_t offset_ = 0;
+    std::size_t limit_ = 0;
+    Block *head_ = nullptr;
+    Block *spare_ = nullptr;
+    std::size_t chain_used_ = 0;
+    std::size_t chain_capacity_ = 0;
+    Finalizer *finalizers_ = nullptr;
+    Overflow *overflow_ = nullptr;
+    std::size_t overflow_count_ = 0;
+    Options options_;
+#if ARENA_ENABLE_STATS
+    Stats stats_;
+#endif
+  };
+
+  /**
+   * @brief An arena with N bytes of inline storage.
+   *
+   * Useful for small scratch arenas on the stack: no heap traffic at all
+   * unless Options::growth_factor lets it spill into chained blocks.
+   *
+   * @code
+   * arena::InlineArena<1024> scratch;
+   * int* xs = scratch->make_array<int>(16);
+   * arena::Arena::Scope scope(scratch);
+   * @endcode
+   *
+   * @note Not copyable or movable: the arena points into this object.
+   */
+  template <std::size_t N>
+  class InlineArena final
+  {
+  public:
+    /// @brief Construct a fixed-size inline arena.
+    InlineArena() noexcept : arena_(std::span<std::byte>(storage_)) {}
+
+    /**
+     * @brief Construct an inline arena with options.
+     * @param options Growth and block caching policy.
+     */
+    explicit InlineArena(const Options &options) noexcept
+        : arena_(std::span<std::byte>(storage_), options)
+    {
+    }
+
+    InlineArena(const InlineArena &) = delete;
+    InlineArena &operator=(const InlineArena &) = delete;
+
+    /// @return The arena allocating from the inline storage.
+    [[nodiscard]] Arena &arena() noexcept { return arena_; }
+
+    /// @return The arena allocating from the inline storage.
+    [[nodiscard]] const Arena &arena() const noexcept { return arena_; }
+
+    Arena *operator->() noexcept { return &arena_; }
+    const Arena *operator->() const noexcept { return &arena_; }
+
+    operator Arena &() noexcept { return arena_; }
+    operator const Arena &() const noexcept { return arena_; }
+
+  private:
+    alignas(std::max_align_t) std::array<std::byte, N> storage_;
+    Arena arena_;
+  };
+
+  /**
+   * @brief An arena over a contiguous range carved from a parent arena.
+   *
+   * The child has its own Mark/Scope/reset and needs no system
+   * allocation, which makes per-request or per-stage hierarchies cheap
+   * (connection arena -> request arena -> parse scratch).
+   *
+   * @code
+   * arena::Arena connection(1 << 20);
+   * {
+   *   arena::SubArena request = connection.child(64 * 1024);
+   *   auto* hdr = request->make<Header>();
+   *   {
+   *     arena::SubArena scratch = request->child(4096);
+   *     ...
+   *   } // on top of request: its bytes go straight back
+   * } // on top of connection: its bytes go straight back
+   * @endcode
+   *
+   * When the child is released (destroyed, move-assigned or release()d),
+   * the parent takes its bytes back if the child is still the parent's
+   * most recent allocation; otherwise they stay allocated until the parent
+   * is rewound or reset.
+   *
+   * @warning The parent must not be rewound or reset past the child while
+   *          the child is alive.
+   */
+  class SubArena final
+  {
+  public:
+    /**
+     * @brief Carve bytes out of parent.
+     * @param parent Arena to take the range from. Must outlive the child.
+     * @param bytes Size of the child's buffer.
+     * @param options Growth and block caching policy for the child.
+     * @throws std::bad_alloc If parent cannot provide the bytes.
+     */
+    SubArena(Arena &parent, std::size_t bytes, const Options &options = Options{})
+        : parent_(&parent),
+          data_(static_cast<std::byte *>(parent.allocate(bytes))),
+          size_(bytes),
+          arena_(std::span<std::byte>(data_, size_), options)
+    {
+    }
+
+    SubArena(const SubArena &) = delete;
+    SubArena &operator=(const SubArena &) = delete;
+
+    SubArena(SubArena &&other) noexcept
+        : parent_(std::exchange(other.parent_, nullptr)),
+          data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          arena_(std::move(other.arena_))
+    {
+    }
+
+    SubArena &operator=(SubArena &&other) noexcept
+    {
+      if (this != &other)
+      {
+        release();
+        parent_ = std::exchange(other.parent_, nullptr);
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        arena_ = std::move(other.arena_);
+      }
+      return *this;
+    }
+
+    /// @brief Release the child (see release()).
+    ~SubArena() { release(); }
+
+    /**
+     * @brief Destroy the child arena and hand its range back to the parent.
+     *
+     * Tracked destructors run first. The parent reclaims the range only if
+     * it is still its most recent allocation. The SubArena is empty
+     * afterwards.
+     */
+    void release() noexcept
+    {
+      if (!parent_)
+        return;
+
+      arena_ = Arena(std::span<std::byte>{});
+      (void)parent_->try_deallocate(data_, size_);
+      parent_ = nullptr;
+      data_ = nullptr;
+      size_ = 0;
+    }
+
+    /// @return The child arena.
+    [[nodiscard]] Arena &arena() noexcept { return arena_; }
+
+    /// @return The child arena.
+    [[nodiscard]] const Arena &arena() const noexcept { return arena_; }
+
+    /// @return The arena the range was carved from (nullptr once released).
+    [[nodiscard]] Arena *parent() const noexcept { return parent_; }
+
+    Arena *operator->() noexcept { return &arena_; }
+    const Arena *operator->() const noexcept { return &arena_; }
+
+    operator Arena &() noexcept { return arena_; }
+    operator const Arena &() const noexcept { return arena_; }
+
+  private:
+    Arena *parent_;
+    std::byte *data_;
+    std::size_t size_;
+    Arena arena_;
+  };
+
+  inline SubArena Arena::child(std::size_t bytes, const Options &options)
+  {
+    return SubArena(*this, bytes, options);
+  }
 } // namespace arena
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+// pop() reads the link of a block another thread may already own; see
+// BlockPool::load_next().
+#if defined(__GNUC__) || defined(__clang__)
+#define ARENA_DETAIL_NO_SANITIZE_THREAD __attribute__((no_sanitize("thread")))
+#else
+#define ARENA_DETAIL_NO_SANITIZE_THREAD
+#endif
+
+namespace arena
+{
+  /**
+   * @brief A shared pool of fixed-size memory blocks.
+   *
+   * Blocks are recycled through a lock-free free list, so arenas that
+   * take their chained blocks from the pool (Options::upstream) never hit
+   * the system allocator once the pool is warm. Requests larger than
+   * block_size() are forwarded to the upstream resource.
+   *
+   * Safe to use from any number of threads at once. pop() may read the
+   * link of a block that another thread has just taken and is writing
+   * to; the value read is then discarded because the tagged head no
+   * longer matches. That read is excluded from ThreadSanitizer.
+   *
+   * @code
+   * arena::BlockPool pool(64 * 1024);
+   * arena::Arena a(0, arena::Options{.growth_factor = 1.0,
+   *                                  .min_block_size = pool.block_size() - arena::Arena::block_overhead(),
+   *                                  .upstream = &pool});
+   * @endcode
+   */
+  class BlockPool final : public std::pmr::memory_resource
+  {
+  public:
+    /// @brief Default size of a pooled block in bytes.
+    static constexpr std::size_t default_block_size = 64 * 1024;
+
+    /// @brief Alignment of every pooled block.
+    static constexpr std::size_t block_alignment = 64;
+
+    /**
+     * @brief Construct a pool.
+     * @param block_size Size in bytes of every pooled block.
+     * @param upstream Resource new blocks come from. Must outlive the pool.
+     */
+    explicit BlockPool(std::size_t block_size = default_block_size,
+                       std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) noexcept
+        : block_size_(block_size < sizeof(Node) ? sizeof(Node) : block_size), upstream_(upstream)
+    {
+    }
+
+    BlockPool(const BlockPool &) = delete;
+    BlockPool &operator=(const BlockPool &) = delete;
+
+    /**
+     * @brief Free the cached blocks.
+     * @note Every block handed out must have been returned by then.
+     */
+    ~BlockPool() override { release(); }
+
+    /**
+     * @brief The process-wide pool used by thread_scratch().
+     */
+    [[nodiscard]] static BlockPool &global() noexcept
+    {
+      static BlockPool pool;
+      return pool;
+    }
+
+    /// @return Size in bytes of every pooled block.
+    [[nodiscard]] std::size_t block_size() const noexcept { return block_size_; }
+
+    /// @return Number of blocks currently cached in the free list (a snapshot).
+    [[nodiscard]] std::size_t free_blocks() const noexcept
+    {
+      return free_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Return every cached block to the upstream resource.
+     * @warning Must not run concurrently with allocations from the pool.
+     */
+    void release() noexcept
+    {
+      while (Node *n = pop())
+        upstream_->deallocate(n, block_size_, block_alignment);
+    }
+
+  protected:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      if (!pooled(bytes, alignment))
+        return upstream_->allocate(bytes, alignment);
+
+      if (Node *n = pop())
+        return n;
+      return upstream_->allocate(block_size_, block_alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+    {
+      if (!pooled(bytes, alignment))
+      {
+        upstream_->deallocate(p, bytes, alignment);
+        return;
+      }
+      push(static_cast<Node *>(p));
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+      return this == &other;
+    }
+
+  private:
+    /// @brief Free-list link stored in the first bytes of a cached block.
+    struct Node
+    {
+      /// @brief Accessed only through store_next()/load_next().
+      Node *next;
+    };
+
+    // The free-list head packs a pointer with a modification counter to
+    // defeat ABA: pointers keep their low 48 bits on 64-bit targets.
+    static constexpr unsigned pointer_bits = sizeof(void *) == 8 ? 48 : 32;
+    static constexpr std::uint64_t pointer_mask = (std::uint64_t{1} << pointer_bits) - 1;
+
+    static Node *pointer(std::uint64_t head) noexcept
+    {
+      return reinterpret_cast<Node *>(static_cast<std::uintptr_t>(head & pointer_mask));
+    }
+
+    static std::uint64_t pack(Node *n, std::uint64_t previous) noexcept
+    {
+      const std::uint64_t tag = (previous >> pointer_bits) + 1;
+      return (tag << pointer_bits) | (static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(n)) & pointer_mask);
+    }
+
+    [[nodiscard]] bool pooled(std::size_t bytes, std::size_t alignment) const noexcept
+    {
+      return bytes <= block_size_ && alignment <= block_alignment;
+    }
+
+    void push(Node *n) noexcept
+    {
+      ::new (static_cast<void *>(n)) Node;
+      std::uint64_t head = head_.load(std::memory_order_relaxed);
+      do
+      {
+        store_next(n, pointer(head));
+      } while (!head_.compare_exchange_weak(head, pack(n, head), std::memory_order_release, std::memory_order_relaxed));
+      free_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] Node *pop() noexcept
+    {
+      std::uint64_t head = head_.load(std::memory_order_acquire);
+      for (;;)
+      {
+        Node *n = pointer(head);
+        if (!n)
+          return nullptr;
+
+        Node *next = load_next(n);
+        if (head_.compare_exchange_weak(head, pack(next, head), std::memory_order_acquire, std::memory_order_acquire))
+        {
+          free_count_.fetch_sub(1, std::memory_order_relaxed);
+          return n;
+        }
+      }
+    }
+
+    /**
+     * @brief Read the link of a block that was the list head when loaded.
+     *
+     * If another thread pops n first, it may already be writing user data
+     * over the link, so this racy read can return garbage. The garbage is
+     * never used: head_'s tag has changed, so the CAS in pop() fails and
+     * retries. n itself stays mapped, since blocks only leave the pool in
+     * release(), which must not run concurrently.
+     */
+    ARENA_DETAIL_NO_SANITIZE_THREAD static Node *load_next(Node *n) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      // The builtin, unlike std::atomic_ref::load(), is inlined here and
+      // so covered by the attribute.
+      return __atomic_load_n(&n->next, __ATOMIC_RELAXED);
+#else
+      return std::atomic_ref<Node *>(n->next).load(std::memory_order_relaxed);
+#endif
+    }
+
+    static void store_next(Node *n, Node *next) noexcept
+    {
+      std::atomic_ref<Node *>(n->next).store(next, std::memory_order_relaxed);
+    }
+
+    std::size_t block_size_;
+    std::pmr::memory_resource *upstream_;
+    std::atomic<std::uint64_t> head_{0};
+    std::atomic<std::size_t> free_count_{0};
+  };
+} // namespace arena
@@ -0,0 +1,364 @@
+#pragma once
+
+#include <arena/arena.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace arena
+{
+  /**
+   * @brief A thread-safe bump-pointer arena.
+   *
+   * Many threads can allocate from one ConcurrentArena at the same time.
+   * The allocation fast path is a single atomic fetch_add on the current
+   * block offset (a CAS loop for over-aligned requests). When the current
+   * block runs out and Options::growth_factor is set, a new block is chained
+   * under a mutex that is only taken on that rare slow path.
+   *
+   * Requests are rounded up to a multiple of granularity bytes so the
+   * offset stays aligned for the fetch_add path.
+   *
+   * @note reset() and destruction must not race with allocations.
+   * @note Like Arena, destructors of objects created with make()/make_array()
+   *       are never called.
+   */
+  class ConcurrentArena final
+  {
+  public:
+    /// @brief Byte storage type used by the internal blocks.
+    using byte = std::byte;
+
+    /// @brief Allocation granularity (and the alignment of the fetch_add path).
+    static constexpr std::size_t granularity = alignof(std::max_align_t);
+
+    /**
+     * @brief Construct a concurrent arena.
+     * @param capacity_bytes Bytes available in the first block.
+     * @param options Only growth_factor and min_block_size apply.
+     * @throws std::bad_alloc If the first block cannot be allocated.
+     */
+    explicit ConcurrentArena(std::size_t capacity_bytes, const Options &options = Options{})
+        : options_(options)
+    {
+      Block *b = new_block(capacity_bytes);
+      if (!b)
+        throw std::bad_alloc{};
+      current_.store(b, std::memory_order_relaxed);
+    }
+
+    ConcurrentArena(const ConcurrentArena &) = delete;
+    ConcurrentArena &operator=(const ConcurrentArena &) = delete;
+
+    /// @brief Free every block.
+    ~ConcurrentArena()
+    {
+      Block *b = current_.load(std::memory_order_relaxed);
+      while (b)
+        b = free_block(b);
+    }
+
+    /**
+     * @brief Reset the arena to empty (all allocations become invalid).
+     *
+     * Only the largest block is kept, so a steady-state workload stops
+     * chaining new blocks after the first few rounds.
+     *
+     * @warning Must not be called while other threads allocate.
+     */
+    void reset() noexcept
+    {
+      Block *largest = nullptr;
+      Block *b = current_.load(std::memory_order_relaxed);
+      while (b)
+      {
+        Block *prev = b->prev;
+        if (!largest || b->size > largest->size)
+        {
+          if (largest)
+            free_block(largest);
+          largest = b;
+        }
+        else
+        {
+          free_block(b);
+        }
+        b = prev;
+      }
+
+      largest->prev = nullptr;
+      largest->offset.store(0, std::memory_order_relaxed);
+      current_.store(largest, std::memory_order_release);
+    }
+
+    /// @return Total capacity in bytes of every block.
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+      std::size_t n = 0;
+      for (const Block *b = current_.load(std::memory_order_acquire); b; b = b->prev)
+        n += b->size;
+      return n;
+    }
+
+    /**
+     * @return Number of bytes currently used.
+     *
+     * This is a snapshot: concurrent allocations may change it at any time.
+     */
+    [[nodiscard]] std::size_t used() const noexcept
+    {
+      std::size_t n = 0;
+      for (const Block *b = current_.load(std::memory_order_acquire); b; b = b->prev)
+      {
+        const std::size_t off = b->offset.load(std::memory_order_relaxed);
+        n += off < b->size ? off : b->size;
+      }
+      return n;
+    }
+
+    /// @return True if the arena chains new blocks when it runs out of space.
+    [[nodiscard]] bool growable() const noexcept { return options_.growth_factor != 0.0; }
+
+    /// @return Number of blocks in the chain.
+    [[nodiscard]] std::size_t block_count() const noexcept
+    {
+      std::size_t n = 0;
+      for (const Block *b = current_.load(std::memory_order_acquire); b; b = b->prev)
+        ++n;
+      return n;
+    }
+
+    /**
+     * @brief Allocate a raw memory block with alignment.
+     * @param size Requested size in bytes (0 will be treated as 1).
+     * @param alignment Requested alignment (must be a power of two).
+     * @return Pointer to the allocated block.
+     * @throws std::bad_alloc If there is not enough space or alignment is invalid.
+     */
+    [[nodiscard]] void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+      void *p = try_allocate(size, alignment);
+      if (!p)
+        throw std::bad_alloc{};
+      return p;
+    }
+
+    /**
+     * @brief Try to allocate a raw memory block with alignment.
+     * @param size Requested size in bytes (0 will be treated as 1).
+     * @param alignment Requested alignment (must be a power of two).
+     * @return Pointer to the allocated block, or nullptr on failure.
+     *
+     * Safe to call from any number of threads at once.
+     */
+    [[nodiscard]] void *try_allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+      if (size == 0)
+        size = 1;
+
+      if (!is_power_of_two(alignment))
+        return nullptr;
+
+      if (size > std::numeric_limits<std::size_t>::max() / 2)
+        return nullptr;
+
+      size = align_up(size, granularity);
+
+      for (;;)
+      {
+        Block *b = current_.load(std::memory_order_acquire);
+        if (void *p = bump(b, size, alignment))
+          return p;
+
+        std::lock_guard<std::mutex> lock(grow_mutex_);
+        if (current_.load(std::memory_order_acquire) != b)
+          continue; // another thread chained a block meanwhile
+
+        if (!growable())
+          return nullptr;
+
+        return grow_and_allocate(b, size, alignment);
+      }
+    }
+
+    /**
+     * @brief Construct an object of type T inside the arena.
+     * @warning The object's destructor is NOT called automatically.
+     */
+    template <class T, class... Args>
+    [[nodiscard]] T *make(Args &&...args)
+    {
+      static_assert(!std::is_void_v<T>, "T must not be void");
+      void *mem = allocate(sizeof(T), alignof(T));
+      return ::new (mem) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Allocate and default-construct an array of T in the arena.
+     * @return Pointer to the first element, or nullptr if count == 0.
+     * @warning Destructors are NOT called automatically.
+     */
+    template <class T>
+    [[nodiscard]] T *make_array(std::size_t count)
+    {
+      static_assert(!std::is_void_v<T>, "T must not be void");
+      if (count == 0)
+        return nullptr;
+
+      if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        throw std::bad_alloc{};
+
+      T *ptr = static_cast<T *>(allocate(sizeof(T) * count, alignof(T)));
+      if constexpr (!std::is_trivially_default_constructible_v<T>)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+          ::new (static_cast<void *>(ptr + i)) T();
+      }
+      return ptr;
+    }
+
+    /**
+     * @brief Check whether a pointer lies within one of the arena blocks.
+     */
+    [[nodiscard]] bool owns(const void *p) const noexcept
+    {
+      const auto *x = static_cast<const byte *>(p);
+      for (const Block *b = current_.load(std::memory_order_acquire); b; b = b->prev)
+      {
+        if (x >= data(b) && x < data(b) + b->size)
+          return true;
+      }
+      return false;
+    }
+
+  private:
+    /**
+     * @brief Header placed in front of every block.
+     *
+     * The offset lives on its own cache line so that bumping it does not
+     * invalidate the read-mostly fields.
+     */
+    struct alignas(64) Block
+    {
+      Block *prev = nullptr;
+      std::size_t size = 0;
+      alignas(64) std::atomic<std::size_t> offset{0};
+    };
+
+    static byte *data(Block *b) noexcept { return reinterpret_cast<byte *>(b + 1); }
+
+    static const byte *data(const Block *b) noexcept { return reinterpret_cast<const byte *>(b + 1); }
+
+    /**
+     * @brief Lock-free bump inside b.
+     * @return The allocation, or nullptr if b is full.
+     */
+    [[nodiscard]] static void *bump(Block *b, std::size_t size, std::size_t alignment) noexcept
+    {
+      if (size > b->size)
+        return nullptr;
+
+      if (alignment <= granularity)
+      {
+        // Keeps a full block from being pushed towards overflow by failing adds.
+        if (b->offset.load(std::memory_order_relaxed) > b->size - size)
+          return nullptr;
+
+        const std::size_t old = b->offset.fetch_add(size, std::memory_order_relaxed);
+        if (old > b->size - size)
+          return nullptr;
+        return data(b) + old;
+      }
+
+      const std::size_t base = reinterpret_cast<std::size_t>(data(b));
+      std::size_t old = b->offset.load(std::memory_order_relaxed);
+      for (;;)
+      {
+        if (old > b->size)
+          return nullptr;
+
+        const std::size_t aligned = align_up(base + old, alignment) - base;
+        if (aligned > b->size - size)
+          return nullptr;
+
+        if (b->offset.compare_exchange_weak(old, aligned + size, std::memory_order_relaxed))
+          return data(b) + aligned;
+      }
+    }
+
+    /**
+     * @brief Chain a new block after full and satisfy the request from it.
+     * @note Called with grow_mutex_ held.
+     */
+    [[nodiscard]] void *grow_and_allocate(Block *full, std::size_t size, std::size_t alignment) noexcept
+    {
+      const std::size_t needed = size + (alignment > granularity ? alignment : 0);
+      std::size_t bytes = next_block_size(full->size);
+      if (bytes < needed)
+        bytes = needed;
+
+      Block *b = new_block(bytes);
+      if (!b)
+        return nullptr;
+
+      const std::size_t base = reinterpret_cast<std::size_t>(data(b));
+      const std::size_t aligned = align_up(base, alignment) - base;
+      b->offset.store(aligned + size, std::memory_order_relaxed);
+      b->prev = full;
+      current_.store(b, std::memory_order_release);
+      return data(b) + aligned;
+    }
+
+    [[nodiscard]] std::size_t next_block_size(std::size_t current) const noexcept
+    {
+      const double factor = options_.growth_factor < 1.0 ? 1.0 : options_.growth_factor;
+      const double scaled = static_cast<double>(current) * factor;
+      const double max = static_cast<double>(std::numeric_limits<std::size_t>::max() / 4);
+
+      std::size_t bytes = scaled >= max ? static_cast<std::size_t>(max) : static_cast<std::size_t>(scaled);
+      if (bytes < options_.min_block_size)
+        bytes = options_.min_block_size;
+      return align_up(bytes, granularity);
+    }
+
+    [[nodiscard]] static Block *new_block(std::size_t bytes) noexcept
+    {
+      bytes = align_up(bytes, granularity);
+      void *mem = ::operator new(sizeof(Block) + bytes, std::align_val_t{alignof(Block)}, std::nothrow);
+      if (!mem)
+        return nullptr;
+
+      Block *b = ::new (mem) Block{};
+      b->size = bytes;
+      return b;
+    }
+
+    /// @brief Free b and return the block before it.
+    static Block *free_block(Block *b) noexcept
+    {
+      Block *prev = b->prev;
+      b->~Block();
+      ::operator delete(b, std::align_val_t{alignof(Block)});
+      return prev;
+    }
+
+    static constexpr bool is_power_of_two(std::size_t x) noexcept
+    {
+      return x != 0 && (x & (x - 1)) == 0;
+    }
+
+    static constexpr std::size_t align_up(std::size_t value, std::size_t alignment) noexcept
+    {
+      return (value + (alignment - 1)) & ~(alignment - 1);
+    }
+
+    std::atomic<Block *> current_{nullptr};
+    std::mutex grow_mutex_;
+    Options options_;
+  };
+} // namespace arena
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <arena/arena.hpp>
+#include <arena/thread_scratch.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace arena
+{
+  /**
+   * @brief Promise mixin that allocates coroutine frames from an Arena.
+   *
+   * Derive a coroutine's promise_type from it. A coroutine whose first
+   * parameters are (std::allocator_arg_t, Arena&) has its frame bumped off
+   * that arena; any other coroutine uses thread_scratch(). Destroying the
+   * frame gives its bytes back when it is the arena's most recent
+   * allocation, so a chain of nested coroutines (each awaited to completion
+   * before its caller finishes) unwinds like a stack and costs no malloc at
+   * all; other frames are reclaimed by the arena's next rewind or reset.
+   *
+   * @code
+   * struct Task
+   * {
+   *   struct promise_type : arena::ArenaPromise { ... };
+   * };
+   *
+   * Task handle(std::allocator_arg_t, arena::Arena& a, Request req);
+   *
+   * arena::Arena::Scope scope(request_arena);
+   * co_await handle(std::allocator_arg, request_arena, req);
+   * @endcode
+   *
+   * The form (Self&, std::allocator_arg_t, Arena&, ...) is accepted too, so
+   * member coroutines can take the arena after the implicit object.
+   *
+   * @warning The arena is not thread-safe: a frame must be created and
+   *          destroyed by threads that do not use the arena concurrently.
+   *          Frames taken from thread_scratch() must be destroyed on the
+   *          thread that created them.
+   */
+  struct ArenaPromise
+  {
+    /// @brief Alignment of every frame (that of the default operator new).
+    static constexpr std::size_t frame_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    /// @brief Bytes in front of each frame recording its arena.
+    static constexpr std::size_t header_size =
+        sizeof(Arena *) > frame_alignment ? sizeof(Arena *) : frame_alignment;
+
+    /// @throws std::bad_alloc If the arena cannot allocate the frame.
+    template <class... Args>
+    static void *operator new(std::size_t size, std::allocator_arg_t, Arena &a, Args &&...)
+    {
+      return allocate_frame(a, size);
+    }
+
+    /// @throws std::bad_alloc If the arena cannot allocate the frame.
+    template <class Self, class... Args>
+    static void *operator new(std::size_t size, Self &&, std::allocator_arg_t, Arena &a, Args &&...)
+    {
+      return allocate_frame(a, size);
+    }
+
+    /// @brief Frames of coroutines without an arena parameter use thread_scratch().
+    static void *operator new(std::size_t size)
+    {
+      return allocate_frame(thread_scratch(), size);
+    }
+
+    static void operator delete(void *frame, std::size_t size) noexcept
+    {
+      auto *header = static_cast<std::byte *>(frame) - header_size;
+      Arena *a = *std::launder(reinterpret_cast<Arena **>(header));
+      (void)a->try_deallocate(header, frame_bytes(size));
+    }
+
+  private:
+    // Rounded up so the next frame needs no padding and frames unwind
+    // back to back.
+    static constexpr std::size_t frame_bytes(std::size_t size) noexcept
+    {
+      return (header_size + size + (frame_alignment - 1)) & ~(frame_alignment - 1);
+    }
+
+    static void *allocate_frame(Arena &a, std::size_t size)
+    {
+      auto *header = static_cast<std::byte *>(a.allocate<frame_alignment>(frame_bytes(size)));
+      ::new (static_cast<void *>(header)) Arena *(&a);
+      return header + header_size;
+    }
+  };
+} // namespace arena
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Set to 1 to record every arena allocation in arena::TraceRing::global().
+ *
+ * Off by default, in which case CallSite is an empty tag and the trailing
+ * call-site arguments of Arena::allocate() and friends compile to nothing.
+ * When on, each allocation records its std::source_location, size,
+ * alignment padding and the arena's used() afterwards (see trace.hpp).
+ */
+#ifndef ARENA_ENABLE_TRACING
+#define ARENA_ENABLE_TRACING 0
+#endif
+
+#if ARENA_ENABLE_TRACING
+#include <source_location>
+#endif
+
+namespace arena
+{
+#if ARENA_ENABLE_TRACING
+  /// @brief Source location of an allocation, captured by default arguments.
+  using CallSite = std::source_location;
+#else
+  /// @brief Empty stand-in for std::source_location when tracing is off.
+  struct CallSite
+  {
+    [[nodiscard]] static constexpr CallSite current() noexcept { return CallSite{}; }
+
+    [[nodiscard]] constexpr const char *file_name() const noexcept { return ""; }
+    [[nodiscard]] constexpr const char *function_name() const noexcept { return ""; }
+    [[nodiscard]] constexpr std::uint_least32_t line() const noexcept { return 0; }
+    [[nodiscard]] constexpr std::uint_least32_t column() const noexcept { return 0; }
+  };
+#endif
+} // namespace arena
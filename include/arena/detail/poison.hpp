@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Set to 1 to poison free arena memory for AddressSanitizer/Valgrind.
+ *
+ * Off by default, in which case every hook compiles to nothing. When on,
+ * memory past the bump offset (and everything released by reset() or
+ * rewind()) is marked inaccessible, allocations are unpoisoned, and a
+ * poisoned redzone of ARENA_POISON_REDZONE bytes follows every allocation.
+ * The marking only has an effect when building under ASan or when
+ * <valgrind/memcheck.h> is available.
+ *
+ * The flag changes Arena's layout and used(), so it must be the same in
+ * every translation unit of a program. The CMake option only turns it on
+ * for non-release configurations.
+ */
+#ifndef ARENA_ENABLE_POISONING
+#define ARENA_ENABLE_POISONING 0
+#endif
+
+/// @brief Bytes of poisoned redzone after each allocation when poisoning is on.
+#ifndef ARENA_POISON_REDZONE
+#define ARENA_POISON_REDZONE 16
+#endif
+
+#if ARENA_ENABLE_POISONING
+#if defined(__SANITIZE_ADDRESS__)
+#define ARENA_DETAIL_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define ARENA_DETAIL_ASAN 1
+#endif
+#endif
+
+#if defined(ARENA_DETAIL_ASAN) && __has_include(<sanitizer/asan_interface.h>)
+#include <sanitizer/asan_interface.h>
+#define ARENA_DETAIL_POISON_ASAN 1
+#endif
+
+#if __has_include(<valgrind/memcheck.h>)
+#include <valgrind/memcheck.h>
+#define ARENA_DETAIL_POISON_VALGRIND 1
+#endif
+#endif
+
+namespace arena::detail
+{
+  /// @brief Redzone appended to every allocation (0 unless poisoning is on).
+  inline constexpr std::size_t redzone_size = ARENA_ENABLE_POISONING ? ARENA_POISON_REDZONE : 0;
+
+  /**
+   * @brief Mark n bytes at p inaccessible.
+   */
+  inline void poison_region([[maybe_unused]] const void *p, [[maybe_unused]] std::size_t n) noexcept
+  {
+#if defined(ARENA_DETAIL_POISON_ASAN)
+    if (n != 0)
+      ASAN_POISON_MEMORY_REGION(p, n);
+#endif
+#if defined(ARENA_DETAIL_POISON_VALGRIND)
+    if (n != 0)
+      VALGRIND_MAKE_MEM_NOACCESS(p, n);
+#endif
+  }
+
+  /**
+   * @brief Mark n bytes at p accessible (contents undefined).
+   */
+  inline void unpoison_region([[maybe_unused]] const void *p, [[maybe_unused]] std::size_t n) noexcept
+  {
+#if defined(ARENA_DETAIL_POISON_ASAN)
+    if (n != 0)
+      ASAN_UNPOISON_MEMORY_REGION(p, n);
+#endif
+#if defined(ARENA_DETAIL_POISON_VALGRIND)
+    if (n != 0)
+      VALGRIND_MAKE_MEM_UNDEFINED(p, n);
+#endif
+  }
+} // namespace arena::detail
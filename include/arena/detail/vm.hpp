@@ -0,0 +1,295 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace arena::detail::vm
+{
+  /**
+   * @brief Return the size of a virtual memory page.
+   */
+  inline std::size_t page_size() noexcept
+  {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<std::size_t>(info.dwPageSize);
+#else
+    const long n = ::sysconf(_SC_PAGESIZE);
+    return n > 0 ? static_cast<std::size_t>(n) : 4096;
+#endif
+  }
+
+  /**
+   * @brief Reserve an inaccessible range of address space.
+   * @param bytes Size of the range (a multiple of page_size()).
+   * @param alignment Requested start alignment (a power of two). Only
+   *        honoured on POSIX systems; Windows aligns to its allocation
+   *        granularity.
+   * @return Start of the range, or nullptr on failure.
+   */
+  inline void *reserve(std::size_t bytes, std::size_t alignment = 0) noexcept
+  {
+#if defined(_WIN32)
+    (void)alignment;
+    return ::VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    if (alignment <= page_size())
+    {
+      void *p = ::mmap(nullptr, bytes, PROT_NONE, flags, -1, 0);
+      return p == MAP_FAILED ? nullptr : p;
+    }
+
+    // Over-reserve, then unmap the misaligned head and the unused tail.
+    const std::size_t padded = bytes + alignment;
+    void *p = ::mmap(nullptr, padded, PROT_NONE, flags, -1, 0);
+    if (p == MAP_FAILED)
+      return nullptr;
+
+    const auto start = reinterpret_cast<std::uintptr_t>(p);
+    const std::uintptr_t aligned = (start + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+    const std::size_t head = aligned - start;
+    if (head != 0)
+      ::munmap(p, head);
+    if (padded - head > bytes)
+      ::munmap(reinterpret_cast<void *>(aligned + bytes), padded - head - bytes);
+    return reinterpret_cast<void *>(aligned);
+#endif
+  }
+
+  /**
+   * @brief Map a committed range backed by explicit huge pages.
+   * @param bytes Size of the range (a multiple of page).
+   * @param page Huge page size in bytes (2 MiB or 1 GiB).
+   * @return Start of the range, or nullptr if huge pages of that size are
+   *         unavailable (no hugetlb pool, missing privilege, unsupported OS).
+   *
+   * The range is released with release().
+   */
+  inline void *map_huge(std::size_t bytes, std::size_t page) noexcept
+  {
+#if defined(_WIN32)
+    const SIZE_T large = ::GetLargePageMinimum();
+    if (large == 0 || page != large)
+      return nullptr;
+    return ::VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+#elif defined(MAP_HUGETLB)
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+    int shift = 0;
+    while ((std::size_t{1} << shift) < page)
+      ++shift;
+    flags |= shift << MAP_HUGE_SHIFT;
+#endif
+    void *p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+    return p == MAP_FAILED ? nullptr : p;
+#else
+    (void)bytes;
+    (void)page;
+    return nullptr;
+#endif
+  }
+
+  /**
+   * @brief Ask the kernel to back a range with transparent huge pages.
+   * @return True if the hint was accepted.
+   */
+  inline bool advise_huge(void *p, std::size_t bytes) noexcept
+  {
+#if defined(MADV_HUGEPAGE)
+    return ::madvise(p, bytes, MADV_HUGEPAGE) == 0;
+#else
+    (void)p;
+    (void)bytes;
+    return false;
+#endif
+  }
+
+  /**
+   * @brief Make a reserved range readable and writable.
+   * @param p Page-aligned start of the range.
+   * @param bytes Size of the range (a multiple of page_size()).
+   * @return True on success.
+   *
+   * Physical pages are still only assigned on first touch.
+   */
+  inline bool commit(void *p, std::size_t bytes) noexcept
+  {
+    if (bytes == 0)
+      return true;
+#if defined(_WIN32)
+    return ::VirtualAlloc(p, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return ::mprotect(p, bytes, PROT_READ | PROT_WRITE) == 0;
+#endif
+  }
+
+  /**
+   * @brief Return the physical pages of a committed range to the OS.
+   * @param p Page-aligned start of the range.
+   * @param bytes Size of the range (a multiple of page_size()).
+   *
+   * The range stays reserved and can be committed again.
+   */
+  inline void decommit(void *p, std::size_t bytes) noexcept
+  {
+    if (bytes == 0)
+      return;
+#if defined(_WIN32)
+    ::VirtualFree(p, bytes, MEM_DECOMMIT);
+#else
+    ::madvise(p, bytes, MADV_DONTNEED);
+    ::mprotect(p, bytes, PROT_NONE);
+#endif
+  }
+
+  /**
+   * @brief Release a range obtained from reserve().
+   * @param p Start of the range.
+   * @param bytes Size passed to reserve().
+   */
+  inline void release(void *p, std::size_t bytes) noexcept
+  {
+    if (!p)
+      return;
+#if defined(_WIN32)
+    (void)bytes;
+    ::VirtualFree(p, 0, MEM_RELEASE);
+#else
+    ::munmap(p, bytes);
+#endif
+  }
+
+  /**
+   * @brief Return the NUMA node of the CPU the calling thread runs on.
+   * @return The node, or -1 if it cannot be determined.
+   */
+  inline int current_numa_node() noexcept
+  {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+      return static_cast<int>(node);
+#endif
+    return -1;
+  }
+
+  /**
+   * @brief Bind the pages of a mapped range to one NUMA node (mbind(MPOL_BIND)).
+   * @param p Start of the range (page aligned).
+   * @param bytes Size of the range.
+   * @param node Target node.
+   * @return False if binding is unsupported or failed; the range is then
+   *         left with the default (first-touch) policy.
+   *
+   * Pages already faulted in are migrated; later faults allocate on node.
+   */
+  inline bool bind_to_node(void *p, std::size_t bytes, int node) noexcept
+  {
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr int mpol_bind = 2;
+    constexpr unsigned mpol_mf_move = 1u << 1;
+    constexpr std::size_t max_nodes = 1024;
+    constexpr std::size_t bits = 8 * sizeof(unsigned long);
+
+    if (node < 0 || static_cast<std::size_t>(node) >= max_nodes)
+      return false;
+
+    unsigned long mask[max_nodes / bits] = {};
+    mask[static_cast<std::size_t>(node) / bits] = 1ul << (static_cast<std::size_t>(node) % bits);
+    return ::syscall(SYS_mbind, p, bytes, mpol_bind, mask, max_nodes + 1, mpol_mf_move) == 0;
+#else
+    (void)p;
+    (void)bytes;
+    (void)node;
+    return false;
+#endif
+  }
+
+  /**
+   * @brief Map a whole file read-only, shared between processes.
+   * @param path File to map.
+   * @param bytes Receives the file size.
+   * @return The mapping, or nullptr if the file cannot be opened, is empty
+   *         or cannot be mapped. Release it with unmap_file().
+   */
+  inline const void *map_file(const char *path, std::size_t &bytes) noexcept
+  {
+    bytes = 0;
+#if defined(_WIN32)
+    HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      return nullptr;
+
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+    if (::GetFileSizeEx(file, &size) && size.QuadPart > 0)
+      mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (!mapping)
+      return nullptr;
+
+    void *p = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping);
+    if (p)
+      bytes = static_cast<std::size_t>(size.QuadPart);
+    return p;
+#else
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      return nullptr;
+
+    struct stat st;
+    void *p = MAP_FAILED;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0)
+      p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+      return nullptr;
+
+    bytes = static_cast<std::size_t>(st.st_size);
+    return p;
+#endif
+  }
+
+  /**
+   * @brief Release a mapping obtained from map_file().
+   * @param p Start of the mapping.
+   * @param bytes Size reported by map_file().
+   */
+  inline void unmap_file(const void *p, std::size_t bytes) noexcept
+  {
+    if (!p)
+      return;
+#if defined(_WIN32)
+    (void)bytes;
+    ::UnmapViewOfFile(p);
+#else
+    ::munmap(const_cast<void *>(p), bytes);
+#endif
+  }
+} // namespace arena::detail::vm
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <arena/arena.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace arena
+{
+  /**
+   * @brief Open-addressing hash map whose tables live in an Arena.
+   *
+   * Linear probing over a power-of-two table with a 3/4 load factor.
+   * Growing rehashes into a fresh table and leaves the old one dead in the
+   * arena, which treats arena memory as scratch storage: the map is meant
+   * for data that is dropped wholesale by reset(), rewind() or Scope.
+   * erase() uses backward-shift deletion, so there are no tombstones.
+   *
+   * @code
+   * arena::Arena a(1 << 16);
+   * arena::FlatMap<int, float> m(a);
+   * m[42] = 1.5f;
+   * if (float* v = m.find(42)) { ... }
+   * @endcode
+   *
+   * K and V must be trivially destructible; the map has no destructor to run.
+   *
+   * @note Not thread-safe. Pointers to entries are invalidated by rehashing
+   *       and by erase().
+   */
+  template <class K, class V, class Hash = std::hash<K>, class Eq = std::equal_to<K>>
+  class FlatMap
+  {
+    static_assert(std::is_trivially_destructible_v<K> && std::is_trivially_destructible_v<V>,
+                  "arena::FlatMap keys and values must be trivially destructible");
+
+  public:
+    /// @brief A stored key/value pair.
+    struct Entry
+    {
+      K key;
+      V value;
+    };
+
+    /// @brief Forward iterator over occupied entries.
+    template <bool Const>
+    class basic_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = Entry;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<Const, const Entry *, Entry *>;
+      using reference = std::conditional_t<Const, const Entry &, Entry &>;
+
+      basic_iterator() noexcept = default;
+
+      [[nodiscard]] reference operator*() const noexcept { return map_->slots_[i_]; }
+      [[nodiscard]] pointer operator->() const noexcept { return map_->slots_ + i_; }
+
+      basic_iterator &operator++() noexcept
+      {
+        ++i_;
+        skip();
+        return *this;
+      }
+
+      basic_iterator operator++(int) noexcept
+      {
+        basic_iterator tmp = *this;
+        ++*this;
+        return tmp;
+      }
+
+      [[nodiscard]] bool operator==(const basic_iterator &other) const noexcept { return i_ == other.i_; }
+
+    private:
+      friend class FlatMap;
+      using map_type = std::conditional_t<Const, const FlatMap, FlatMap>;
+
+      basic_iterator(map_type *m, std::size_t i) noexcept : map_(m), i_(i) { skip(); }
+
+      void skip() noexcept
+      {
+        while (i_ < map_->capacity_ && !map_->full_[i_])
+          ++i_;
+      }
+
+      map_type *map_ = nullptr;
+      std::size_t i_ = 0;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /**
+     * @brief Create an empty map.
+     * @param a Arena to allocate tables from. Must outlive the map.
+     */
+    explicit FlatMap(Arena &a, Hash hash = Hash{}, Eq eq = Eq{}) noexcept
+        : arena_(&a), hash_(std::move(hash)), eq_(std::move(eq))
+    {
+    }
+
+    FlatMap(const FlatMap &) = delete;
+    FlatMap &operator=(const FlatMap &) = delete;
+
+    /// @return Number of entries.
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /// @return True if the map has no entries.
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /// @return Number of slots in the current table.
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    /// @return The arena tables are allocated from.
+    [[nodiscard]] Arena &arena() const noexcept { return *arena_; }
+
+    [[nodiscard]] iterator begin() noexcept { return iterator(this, 0); }
+    [[nodiscard]] iterator end() noexcept { return iterator(this, capacity_); }
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(this, capacity_); }
+
+    /**
+     * @brief Ensure n entries fit without rehashing.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    void reserve(std::size_t n)
+    {
+      if (n > max_load())
+        rehash(table_size_for(n));
+    }
+
+    /**
+     * @brief Look up a key.
+     * @return Pointer to the value, or nullptr if the key is absent.
+     */
+    [[nodiscard]] V *find(const K &key) noexcept
+    {
+      const std::size_t i = index_of(key);
+      return i == npos ? nullptr : &slots_[i].value;
+    }
+
+    [[nodiscard]] const V *find(const K &key) const noexcept
+    {
+      const std::size_t i = index_of(key);
+      return i == npos ? nullptr : &slots_[i].value;
+    }
+
+    /**
+     * @brief Look up a key.
+     * @return Pointer to the stored entry, or nullptr if the key is absent.
+     */
+    [[nodiscard]] Entry *find_entry(const K &key) noexcept
+    {
+      const std::size_t i = index_of(key);
+      return i == npos ? nullptr : slots_ + i;
+    }
+
+    [[nodiscard]] const Entry *find_entry(const K &key) const noexcept
+    {
+      const std::size_t i = index_of(key);
+      return i == npos ? nullptr : slots_ + i;
+    }
+
+    /// @return True if the key is present.
+    [[nodiscard]] bool contains(const K &key) const noexcept { return index_of(key) != npos; }
+
+    /**
+     * @brief Insert key with a value built from args, unless it is present.
+     * @return The entry for key and whether it was inserted.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    template <class... Args>
+    std::pair<Entry *, bool> try_emplace(const K &key, Args &&...args)
+    {
+      // Look up first: finding an existing key must not grow the table.
+      const std::size_t h = hash_(key);
+      std::size_t i = 0;
+      if (capacity_ != 0)
+      {
+        for (i = home(h); full_[i]; i = (i + 1) & (capacity_ - 1))
+        {
+          if (eq_(slots_[i].key, key))
+            return {slots_ + i, false};
+        }
+      }
+
+      if (size_ + 1 > max_load())
+      {
+        rehash(capacity_ == 0 ? min_capacity : capacity_ * 2);
+        i = home(h);
+        while (full_[i])
+          i = (i + 1) & (capacity_ - 1);
+      }
+
+      ::new (static_cast<void *>(slots_ + i)) Entry{key, V(std::forward<Args>(args)...)};
+      full_[i] = 1;
+      ++size_;
+      return {slots_ + i, true};
+    }
+
+    /**
+     * @brief Access the value for key, value-initializing it if absent.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    V &operator[](const K &key) { return try_emplace(key).first->value; }
+
+    /**
+     * @brief Remove a key.
+     * @return True if the key was present.
+     */
+    bool erase(const K &key) noexcept
+    {
+      std::size_t hole = index_of(key);
+      if (hole == npos)
+        return false;
+
+      const std::size_t mask = capacity_ - 1;
+      for (std::size_t i = (hole + 1) & mask; full_[i]; i = (i + 1) & mask)
+      {
+        // Shift back any entry whose probe sequence passes through the hole.
+        const std::size_t h = home(hash_(slots_[i].key));
+        if (((i - h) & mask) >= ((i - hole) & mask))
+        {
+          ::new (static_cast<void *>(slots_ + hole)) Entry(std::move(slots_[i]));
+          hole = i;
+        }
+      }
+
+      full_[hole] = 0;
+      --size_;
+      return true;
+    }
+
+    /// @brief Remove all entries; the table is kept.
+    void clear() noexcept
+    {
+      if (full_)
+        std::memset(full_, 0, capacity_);
+      size_ = 0;
+    }
+
+  private:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t min_capacity = 16;
+
+    [[nodiscard]] std::size_t max_load() const noexcept { return capacity_ - capacity_ / 4; }
+
+    [[nodiscard]] static std::size_t table_size_for(std::size_t n)
+    {
+      std::size_t cap = min_capacity;
+      while (cap - cap / 4 < n)
+      {
+        if (cap > std::numeric_limits<std::size_t>::max() / 2)
+          throw std::bad_alloc{};
+        cap *= 2;
+      }
+      return cap;
+    }
+
+    /// @brief Fibonacci hashing spreads weak hashes (e.g. identity) over the table.
+    [[nodiscard]] std::size_t home(std::size_t h) const noexcept
+    {
+      return static_cast<std::size_t>((static_cast<std::uint64_t>(h) * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    [[nodiscard]] std::size_t index_of(const K &key) const noexcept
+    {
+      if (size_ == 0)
+        return npos;
+
+      for (std::size_t i = home(hash_(key));; i = (i + 1) & (capacity_ - 1))
+      {
+        if (!full_[i])
+          return npos;
+        if (eq_(slots_[i].key, key))
+          return i;
+      }
+    }
+
+    void rehash(std::size_t new_capacity)
+    {
+      if (new_capacity > std::numeric_limits<std::size_t>::max() / (sizeof(Entry) + 1))
+        throw std::bad_alloc{};
+
+      auto *slots = static_cast<Entry *>(arena_->allocate<alignof(Entry)>(new_capacity * sizeof(Entry)));
+      auto *full = static_cast<unsigned char *>(arena_->allocate<1>(new_capacity));
+      std::memset(full, 0, new_capacity);
+
+      Entry *old_slots = slots_;
+      unsigned char *old_full = full_;
+      const std::size_t old_capacity = capacity_;
+
+      slots_ = slots;
+      full_ = full;
+      capacity_ = new_capacity;
+      shift_ = 64;
+      for (std::size_t c = new_capacity; c > 1; c >>= 1)
+        --shift_;
+
+      for (std::size_t j = 0; j < old_capacity; ++j)
+      {
+        if (!old_full[j])
+          continue;
+
+        std::size_t i = home(hash_(old_slots[j].key));
+        while (full_[i])
+          i = (i + 1) & (capacity_ - 1);
+        ::new (static_cast<void *>(slots_ + i)) Entry(std::move(old_slots[j]));
+        full_[i] = 1;
+      }
+    }
+
+    Arena *arena_;
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] Eq eq_;
+
+    Entry *slots_ = nullptr;
+    unsigned char *full_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t size_ = 0;
+    unsigned shift_ = 64;
+  };
+} // namespace arena
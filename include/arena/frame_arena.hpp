@@ -0,0 +1,156 @@
+#pragma once
+
+#include <arena/arena.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace arena
+{
+  /**
+   * @brief A ring of N arenas for data that lives for exactly N frames.
+   *
+   * Allocation goes to the current frame. advance() resets the oldest
+   * arena and makes it current, so memory allocated in frame k stays valid
+   * until frame k + N begins. With N = 2 this is a double buffer: a
+   * producer fills frame k + 1 while a consumer still reads frame k,
+   * without copying.
+   *
+   * @code
+   * arena::FrameArena<3> frames(1 << 20);
+   * for (;;)
+   * {
+   *   Batch* b = frames->make<Batch>();
+   *   pipeline.push(b); // valid for this frame and the next two
+   *   frames.advance();
+   * }
+   * @endcode
+   *
+   * @tparam N Number of frames kept alive (at least 2).
+   * @note Not thread-safe: advance() must not race with allocations.
+   */
+  template <std::size_t N>
+  class FrameArena final
+  {
+    static_assert(N >= 2, "FrameArena needs at least two frames");
+
+  public:
+    /// @brief Number of frames in the ring.
+    static constexpr std::size_t frame_count = N;
+
+    /**
+     * @brief Construct N arenas of capacity_bytes each.
+     * @param capacity_bytes Capacity of every frame's arena.
+     * @param options Options applied to every frame's arena.
+     * @throws std::bad_alloc If a buffer cannot be obtained.
+     */
+    explicit FrameArena(std::size_t capacity_bytes, const Options &options = Options{})
+        : frames_(make_frames(capacity_bytes, options, std::make_index_sequence<N>{}))
+    {
+    }
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    /// @return The arena of the current frame.
+    [[nodiscard]] Arena &current() noexcept { return frames_[current_]; }
+    [[nodiscard]] const Arena &current() const noexcept { return frames_[current_]; }
+
+    Arena *operator->() noexcept { return &current(); }
+    const Arena *operator->() const noexcept { return &current(); }
+
+    operator Arena &() noexcept { return current(); }
+
+    /**
+     * @brief Arena of a live frame.
+     * @param age 0 for the current frame, N - 1 for the oldest one.
+     */
+    [[nodiscard]] Arena &frame(std::size_t age) noexcept { return frames_[slot(age)]; }
+    [[nodiscard]] const Arena &frame(std::size_t age) const noexcept { return frames_[slot(age)]; }
+
+    /// @return Number of advance() calls since construction.
+    [[nodiscard]] std::uint64_t frame_index() const noexcept { return index_; }
+
+    /**
+     * @brief Start a new frame.
+     *
+     * Resets the oldest frame's arena (invalidating what was allocated
+     * N frames ago) and makes it current.
+     */
+    void advance() noexcept
+    {
+      const std::size_t oldest = slot(N - 1);
+      record(frames_[current_].used());
+      record(frames_[oldest].used());
+
+      frames_[oldest].reset();
+      current_ = oldest;
+      ++index_;
+    }
+
+    /// @brief Reset every frame; the frame index keeps counting.
+    void reset() noexcept
+    {
+      for (Arena &a : frames_)
+      {
+        record(a.used());
+        a.reset();
+      }
+    }
+
+    /**
+     * @return The highest used() any single frame reached.
+     *
+     * Compare with the per-frame capacity to size the arenas, and with
+     * frame_used() to size N.
+     */
+    [[nodiscard]] std::size_t peak_used() const noexcept
+    {
+      std::size_t peak = peak_;
+      for (const Arena &a : frames_)
+      {
+        if (a.used() > peak)
+          peak = a.used();
+      }
+      return peak;
+    }
+
+    /// @return Bytes used by all live frames together.
+    [[nodiscard]] std::size_t used() const noexcept
+    {
+      std::size_t n = 0;
+      for (const Arena &a : frames_)
+        n += a.used();
+      return n;
+    }
+
+    /// @return used() of a live frame (0 = current, N - 1 = oldest).
+    [[nodiscard]] std::size_t frame_used(std::size_t age) const noexcept { return frame(age).used(); }
+
+  private:
+    template <std::size_t... I>
+    static std::array<Arena, N> make_frames(std::size_t capacity_bytes, const Options &options,
+                                            std::index_sequence<I...>)
+    {
+      return {{((void)I, Arena(capacity_bytes, options))...}};
+    }
+
+    [[nodiscard]] std::size_t slot(std::size_t age) const noexcept
+    {
+      return (current_ + N - (age % N)) % N;
+    }
+
+    void record(std::size_t used) noexcept
+    {
+      if (used > peak_)
+        peak_ = used;
+    }
+
+    std::array<Arena, N> frames_;
+    std::size_t current_ = 0;
+    std::uint64_t index_ = 0;
+    std::size_t peak_ = 0;
+  };
+} // namespace arena
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <arena/arena.hpp>
+#include <arena/concurrent_arena.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace arena
+{
+  /**
+   * @brief Usage of one Lease.
+   *
+   * Snapshots can be aggregated with operator+= (e.g. across the tasks of
+   * one query).
+   */
+  struct LeaseStats
+  {
+    /// @brief Sub-chunks leased from the shared arena.
+    std::size_t leases = 0;
+
+    /// @brief Bytes leased from the shared arena (block headers included).
+    std::size_t leased_bytes = 0;
+
+    /// @brief Bytes left unused at the end of sub-chunks the lease moved past.
+    std::size_t wasted_bytes = 0;
+
+    /// @brief Bytes still free in the current sub-chunk.
+    std::size_t remaining_bytes = 0;
+
+    LeaseStats &operator+=(const LeaseStats &other) noexcept
+    {
+      leases += other.leases;
+      leased_bytes += other.leased_bytes;
+      wasted_bytes += other.wasted_bytes;
+      remaining_bytes += other.remaining_bytes;
+      return *this;
+    }
+  };
+
+  /**
+   * @brief A single-threaded Arena that leases sub-chunks from a ConcurrentArena.
+   *
+   * Each thread (or task) owns a Lease. Allocations bump inside the current
+   * sub-chunk with no synchronization at all; only taking a new sub-chunk
+   * touches the shared arena, with one atomic fetch_add. That removes
+   * contention on the shared counter while still giving one global reset()
+   * for everything the tasks built.
+   *
+   * @code
+   * arena::ConcurrentArena shared(64 << 20, arena::Options{.growth_factor = 2.0});
+   *
+   * // in each task:
+   * arena::Lease lease(shared);
+   * auto* row = lease->make<Row>(...);
+   * arena::Vector<Row*> rows(lease); // a Lease is an Arena
+   *
+   * // once every task (and its Lease) is done:
+   * shared.reset();
+   * @endcode
+   *
+   * Rewinding or resetting the lease keeps its sub-chunks for reuse;
+   * nothing is ever handed back to the shared arena before its reset().
+   *
+   * @warning Every Lease must be destroyed before the shared arena is reset
+   *          or destroyed.
+   * @note A Lease is not thread-safe; the shared arena is.
+   */
+  class Lease final
+  {
+  public:
+    /// @brief Default sub-chunk size, block header included.
+    static constexpr std::size_t default_lease_size = std::size_t{64} << 10;
+
+    /**
+     * @brief Create a lease over a shared arena.
+     * @param shared Arena to lease sub-chunks from. Must outlive the lease.
+     * @param lease_size Bytes taken from the shared arena per sub-chunk,
+     *        block header included. Larger allocations get a dedicated
+     *        sub-chunk of the size they need.
+     */
+    explicit Lease(ConcurrentArena &shared, std::size_t lease_size = default_lease_size) noexcept
+        : upstream_(shared),
+          arena_(std::span<std::byte>{}, Options{
+                                             .growth_factor = 1.0,
+                                             .min_block_size = usable(lease_size),
+                                             .upstream = &upstream_,
+                                             .fixed_block_size = true,
+                                         })
+    {
+    }
+
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+
+    /// @return The lease's arena.
+    [[nodiscard]] Arena &arena() noexcept { return arena_; }
+    [[nodiscard]] const Arena &arena() const noexcept { return arena_; }
+
+    Arena *operator->() noexcept { return &arena_; }
+    const Arena *operator->() const noexcept { return &arena_; }
+
+    operator Arena &() noexcept { return arena_; }
+
+    /// @return The arena sub-chunks are leased from.
+    [[nodiscard]] ConcurrentArena &shared() const noexcept { return upstream_.shared(); }
+
+    /// @return A snapshot of this lease's usage.
+    [[nodiscard]] LeaseStats stats() const noexcept
+    {
+      LeaseStats s;
+      s.leases = upstream_.leases();
+      s.leased_bytes = upstream_.leased_bytes();
+      s.remaining_bytes = arena_.remaining();
+      // Bytes of full sub-chunks that were never handed out.
+      s.wasted_bytes = arena_.capacity() - arena_.remaining() - arena_.used();
+      return s;
+    }
+
+  private:
+    /// @brief Upstream resource that bumps sub-chunks off the shared arena.
+    class Upstream final : public std::pmr::memory_resource
+    {
+    public:
+      explicit Upstream(ConcurrentArena &shared) noexcept : shared_(&shared) {}
+
+      [[nodiscard]] ConcurrentArena &shared() const noexcept { return *shared_; }
+      [[nodiscard]] std::size_t leases() const noexcept { return leases_; }
+      [[nodiscard]] std::size_t leased_bytes() const noexcept { return leased_bytes_; }
+
+    protected:
+      void *do_allocate(std::size_t bytes, std::size_t alignment) override
+      {
+        void *p = shared_->allocate(bytes, alignment);
+        ++leases_;
+        leased_bytes_ += bytes;
+        return p;
+      }
+
+      // Sub-chunks die with the shared arena's reset().
+      void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+      bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+      {
+        return this == &other;
+      }
+
+    private:
+      ConcurrentArena *shared_;
+      std::size_t leases_ = 0;
+      std::size_t leased_bytes_ = 0;
+    };
+
+    static constexpr std::size_t usable(std::size_t lease_size) noexcept
+    {
+      return lease_size > 2 * Arena::block_overhead() ? lease_size - Arena::block_overhead()
+                                                      : Arena::block_overhead();
+    }
+
+    Upstream upstream_;
+    Arena arena_;
+  };
+} // namespace arena
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <arena/arena.hpp>
+#include <arena/block_pool.hpp>
+#include <arena/detail/vm.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+namespace arena
+{
+  /// @brief Highest NUMA node count served by node_block_pool().
+  inline constexpr int max_numa_nodes = 64;
+
+  /**
+   * @brief memory_resource handing out mapped memory bound to one NUMA node.
+   *
+   * Every allocation is its own page-rounded mapping bound with mbind(), so
+   * this is meant as the upstream of a pool (see node_block_pool()), not for
+   * small objects. Where binding is not supported the memory keeps the
+   * default first-touch policy.
+   */
+  class NumaResource final : public std::pmr::memory_resource
+  {
+  public:
+    /// @param node NUMA node to bind allocations to.
+    explicit NumaResource(int node) noexcept : node_(node) {}
+
+    /// @return The node allocations are bound to.
+    [[nodiscard]] int node() const noexcept { return node_; }
+
+  protected:
+    /// @throws std::bad_alloc If the mapping fails.
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      const std::size_t page = detail::vm::page_size();
+      const std::size_t size = round_up(bytes ? bytes : 1, page);
+      void *p = detail::vm::reserve(size, alignment > page ? alignment : 0);
+      if (!p)
+        throw std::bad_alloc{};
+
+      (void)detail::vm::bind_to_node(p, size, node_);
+      if (!detail::vm::commit(p, size))
+      {
+        detail::vm::release(p, size);
+        throw std::bad_alloc{};
+      }
+      return p;
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t) override
+    {
+      detail::vm::release(p, round_up(bytes ? bytes : 1, detail::vm::page_size()));
+    }
+
+    /// @return True if other is a NumaResource for the same node.
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+      const auto *r = dynamic_cast<const NumaResource *>(&other);
+      return r && r->node_ == node_;
+    }
+
+  private:
+    static std::size_t round_up(std::size_t value, std::size_t page) noexcept
+    {
+      return (value + (page - 1)) & ~(page - 1);
+    }
+
+    int node_;
+  };
+
+  /**
+   * @brief Return the process-wide block pool for a NUMA node.
+   * @param node NUMA node. Out-of-range values (including -1, unknown)
+   *        return BlockPool::global().
+   *
+   * Pools are created on first use and live until the process exits. Their
+   * blocks are bound to node, so arenas that chain blocks from them (see
+   * numa_thread_scratch()) keep their memory local.
+   */
+  [[nodiscard]] inline BlockPool &node_block_pool(int node) noexcept
+  {
+    struct NodePool
+    {
+      explicit NodePool(int n) noexcept : resource(n), pool(BlockPool::default_block_size, &resource) {}
+
+      NumaResource resource;
+      BlockPool pool;
+    };
+
+    if (node < 0 || node >= max_numa_nodes)
+      return BlockPool::global();
+
+    // Leaked on purpose: threads may still return blocks during exit.
+    static std::array<std::atomic<NodePool *>, max_numa_nodes> pools{};
+    std::atomic<NodePool *> &slot = pools[static_cast<std::size_t>(node)];
+
+    NodePool *p = slot.load(std::memory_order_acquire);
+    if (!p)
+    {
+      auto *fresh = new (std::nothrow) NodePool(node);
+      if (!fresh)
+        return BlockPool::global();
+
+      if (slot.compare_exchange_strong(p, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+        p = fresh;
+      else
+        delete fresh;
+    }
+    return p->pool;
+  }
+
+  /**
+   * @brief Return the calling thread's NUMA-local scratch arena.
+   *
+   * Like thread_scratch(), but blocks come from node_block_pool() for the
+   * node the thread runs on when it first calls this, so scratch memory
+   * stays local to that socket.
+   */
+  [[nodiscard]] inline Arena &numa_thread_scratch() noexcept
+  {
+    thread_local BlockPool &pool = node_block_pool(detail::vm::current_numa_node());
+    thread_local Arena scratch(0, Options{
+                                      .growth_factor = 1.0,
+                                      .min_block_size = pool.block_size() - Arena::block_overhead(),
+                                      .cache_blocks = false,
+                                      .upstream = &pool,
+                                  });
+    return scratch;
+  }
+} // namespace arena
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <arena/arena.hpp>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace arena
+{
+  namespace detail
+  {
+    /**
+     * @brief Untyped fixed-size slot allocator carved from an Arena.
+     *
+     * Slots are taken from chunks allocated in the arena. Freed slots go on
+     * an intrusive singly-linked free list and are reused before any fresh
+     * slot, so allocate() and deallocate() are O(1) and never touch the
+     * system allocator.
+     *
+     * @note Not thread-safe. The arena must not be reset or rewound past
+     *       the pool's chunks while the pool is in use.
+     */
+    class SlotPool
+    {
+    public:
+      /**
+       * @brief Create a pool of slots.
+       * @param a Arena to carve chunks from. Must outlive the pool.
+       * @param slot_size Minimum slot size in bytes.
+       * @param alignment Slot alignment (must be a power of two).
+       * @param slots_per_chunk Number of slots obtained per arena allocation.
+       */
+      SlotPool(Arena &a, std::size_t slot_size, std::size_t alignment, std::size_t slots_per_chunk) noexcept
+          : arena_(&a),
+            alignment_(alignment < alignof(FreeSlot) ? alignof(FreeSlot) : alignment),
+            slot_size_(round_up(slot_size < sizeof(FreeSlot) ? sizeof(FreeSlot) : slot_size, alignment_)),
+            slots_per_chunk_(slots_per_chunk == 0 ? 1 : slots_per_chunk)
+      {
+      }
+
+      SlotPool(const SlotPool &) = delete;
+      SlotPool &operator=(const SlotPool &) = delete;
+
+      /// @return Size of one slot in bytes (a multiple of alignment()).
+      [[nodiscard]] std::size_t slot_size() const noexcept { return slot_size_; }
+
+      /// @return Alignment of every slot.
+      [[nodiscard]] std::size_t alignment() const noexcept { return alignment_; }
+
+      /// @return Number of slots currently handed out.
+      [[nodiscard]] std::size_t live() const noexcept { return live_; }
+
+      /// @return Number of slots on the free list.
+      [[nodiscard]] std::size_t free_slots() const noexcept { return free_count_; }
+
+      /// @return Total number of slots in all chunks.
+      [[nodiscard]] std::size_t capacity() const noexcept { return chunk_count_ * slots_per_chunk_; }
+
+      /// @return Number of chunks obtained from the arena.
+      [[nodiscard]] std::size_t chunk_count() const noexcept { return chunk_count_; }
+
+      /// @return The arena chunks are carved from.
+      [[nodiscard]] Arena &arena() const noexcept { return *arena_; }
+
+      /**
+       * @brief Take a slot.
+       * @return Pointer to an uninitialized slot, or nullptr if the arena
+       *         could not provide a new chunk.
+       */
+      [[nodiscard]] void *try_allocate() noexcept
+      {
+        if (free_)
+        {
+          FreeSlot *s = free_;
+          free_ = s->next;
+          --free_count_;
+          ++live_;
+          return s;
+        }
+
+        if (fresh_ == fresh_end_ && !add_chunk())
+          return nullptr;
+
+        void *p = fresh_;
+        fresh_ += slot_size_;
+        ++live_;
+        return p;
+      }
+
+      /**
+       * @brief Return a slot to the free list.
+       * @param p Slot previously obtained from this pool (nullptr is ignored).
+       */
+      void deallocate(void *p) noexcept
+      {
+        if (!p)
+          return;
+
+        FreeSlot *s = ::new (p) FreeSlot{free_};
+        free_ = s;
+        ++free_count_;
+        --live_;
+      }
+
+      /**
+       * @brief Check whether a pointer lies within one of the pool's chunks.
+       * @param p Pointer to test.
+       * @return True if p points into a slot of this pool.
+       *
+       * O(number of chunks).
+       */
+      [[nodiscard]] bool owns(const void *p) const noexcept
+      {
+        const auto *b = static_cast<const std::byte *>(p);
+        for (const Chunk *c = chunks_; c; c = c->prev)
+        {
+          const std::byte *first = slots_of(c);
+          if (b >= first && b < first + slot_size_ * slots_per_chunk_)
+            return true;
+        }
+        return false;
+      }
+
+    private:
+      struct FreeSlot
+      {
+        FreeSlot *next;
+      };
+
+      struct Chunk
+      {
+        Chunk *prev;
+      };
+
+      static constexpr std::size_t round_up(std::size_t value, std::size_t alignment) noexcept
+      {
+        return (value + (alignment - 1)) & ~(alignment - 1);
+      }
+
+      [[nodiscard]] std::size_t header_size() const noexcept
+      {
+        return round_up(sizeof(Chunk), alignment_);
+      }
+
+      [[nodiscard]] const std::byte *slots_of(const Chunk *c) const noexcept
+      {
+        return reinterpret_cast<const std::byte *>(c) + header_size();
+      }
+
+      bool add_chunk() noexcept
+      {
+        const std::size_t bytes = header_size() + slot_size_ * slots_per_chunk_;
+        void *mem = arena_->try_allocate(bytes, alignment_);
+        if (!mem)
+          return false;
+
+        Chunk *c = ::new (mem) Chunk{chunks_};
+        chunks_ = c;
+        ++chunk_count_;
+
+        fresh_ = static_cast<std::byte *>(mem) + header_size();
+        fresh_end_ = fresh_ + slot_size_ * slots_per_chunk_;
+        return true;
+      }
+
+      Arena *arena_;
+      std::size_t alignment_;
+      std::size_t slot_size_;
+      std::size_t slots_per_chunk_;
+
+      FreeSlot *free_ = nullptr;
+      Chunk *chunks_ = nullptr;
+      std::byte *fresh_ = nullptr;
+      std::byte *fresh_end_ = nullptr;
+
+      std::size_t live_ = 0;
+      std::size_t free_count_ = 0;
+      std::size_t chunk_count_ = 0;
+    };
+  } // namespace detail
+
+  /**
+   * @brief Fixed-size object pool layered on an Arena.
+   *
+   * For objects that must be freed one at a time (connection state,
+   * timers, ...). Slots are carved from the arena in chunks and recycled
+   * through an intrusive free list, so create() and destroy() are O(1) and
+   * never go through the system allocator.
+   *
+   * @tparam T Object type.
+   * @tparam Alignment Slot alignment. Pass arena::cache_line_size to give
+   *         every object its own cache line and avoid false sharing.
+   *
+   * @code
+   * arena::Arena a(1 << 20);
+   * arena::Pool<Connection, arena::cache_line_size> pool(a);
+   * Connection* c = pool.create(fd);
+   * pool.destroy(c); // slot is reused by the next create()
+   * @endcode
+   *
+   * @warning Objects still alive when the pool goes away are not destroyed.
+   *          The arena must not be reset or rewound past the pool's chunks
+   *          while the pool is in use.
+   *
+   * @note Not thread-safe.
+   */
+  template <class T, std::size_t Alignment = alignof(T)>
+  class Pool final
+  {
+    static_assert(!std::is_void_v<T>, "T must not be void");
+    static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+  public:
+    /// @brief Effective slot alignment.
+    static constexpr std::size_t slot_alignment = Alignment < alignof(T) ? alignof(T) : Alignment;
+
+    /**
+     * @brief Create a pool over an arena.
+     * @param a Arena to carve slots from. Must outlive the pool.
+     * @param slots_per_chunk Number of slots obtained per arena allocation.
+     */
+    explicit Pool(Arena &a, std::size_t slots_per_chunk = 64) noexcept
+        : slots_(a, sizeof(T), slot_alignment, slots_per_chunk)
+    {
+    }
+
+    Pool(const Pool &) = delete;
+    Pool &operator=(const Pool &) = delete;
+
+    /**
+     * @brief Construct an object in a free slot.
+     * @param args Constructor arguments forwarded to T's constructor.
+     * @return Pointer to the new object.
+     * @throws std::bad_alloc If the arena cannot provide a new chunk.
+     */
+    template <class... Args>
+    [[nodiscard]] T *create(Args &&...args)
+    {
+      void *mem = slots_.try_allocate();
+      if (!mem)
+        throw std::bad_alloc{};
+
+      if constexpr (std::is_nothrow_constructible_v<T, Args &&...>)
+      {
+        return ::new (mem) T(std::forward<Args>(args)...);
+      }
+      else
+      {
+        try
+        {
+          return ::new (mem) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+          slots_.deallocate(mem);
+          throw;
+        }
+      }
+    }
+
+    /**
+     * @brief Destroy an object and recycle its slot.
+     * @param p Object previously returned by create() (nullptr is ignored).
+     */
+    void destroy(T *p) noexcept
+    {
+      if (!p)
+        return;
+
+      p->~T();
+      slots_.deallocate(p);
+    }
+
+    /// @return True if p points into one of the pool's slots.
+    [[nodiscard]] bool owns(const void *p) const noexcept { return slots_.owns(p); }
+
+    /// @return Number of live objects.
+    [[nodiscard]] std::size_t live() const noexcept { return slots_.live(); }
+
+    /// @return Number of recycled slots waiting for reuse.
+    [[nodiscard]] std::size_t free_slots() const noexcept { return slots_.free_slots(); }
+
+    /// @return Total number of slots obtained from the arena.
+    [[nodiscard]] std::size_t capacity() const noexcept { return slots_.capacity(); }
+
+    /// @return Size of one slot in bytes.
+    [[nodiscard]] std::size_t slot_size() const noexcept { return slots_.slot_size(); }
+
+    /// @return Number of chunks obtained from the arena.
+    [[nodiscard]] std::size_t chunk_count() const noexcept { return slots_.chunk_count(); }
+
+    /// @return The arena slots are carved from.
+    [[nodiscard]] Arena &arena() const noexcept { return slots_.arena(); }
+
+  private:
+    detail::SlotPool slots_;
+  };
+} // namespace arena
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace arena
+{
+  /**
+   * @brief Compact reference to an object in an arena's initial buffer.
+   *
+   * Stores the object's offset from Arena::buffer() in an unsigned integer
+   * (32 bits by default) instead of a 64-bit pointer, which halves the size
+   * of pointer-heavy nodes and fits more of them per cache line. Resolving
+   * needs the arena (or any base the buffer was copied to, such as a
+   * MappedSnapshot's data()); the offsets stay valid if the buffer moves.
+   *
+   * @code
+   * struct Node
+   * {
+   *   std::uint32_t key;
+   *   arena::Ref<Node> left, right; // 12 bytes instead of 24
+   * };
+   *
+   * Node* n = a.make<Node>();
+   * auto r = arena::Ref<Node>::to(a, n);
+   * assert(r.get(a) == n);
+   * @endcode
+   *
+   * Only objects in the initial buffer can be referenced: use a fixed-size
+   * or reserved arena (see Options::reserve_bytes) so nothing is ever placed
+   * in a chained block. Conversions debug-assert this with owns().
+   *
+   * @tparam T Referenced type.
+   * @tparam Offset Unsigned integer type holding the offset. The largest
+   *         addressable offset is its maximum minus one (0 encodes null).
+   */
+  template <class T, class Offset = std::uint32_t>
+  class Ref
+  {
+    static_assert(std::is_integral_v<Offset> && std::is_unsigned_v<Offset>,
+                  "Ref offsets must be an unsigned integer type");
+
+  public:
+    using element_type = T;
+    using offset_type = Offset;
+
+    /// @brief Largest offset a Ref can hold.
+    static constexpr std::size_t max_offset = std::size_t{std::numeric_limits<Offset>::max()} - 1;
+
+    /// @brief A null reference.
+    constexpr Ref() noexcept = default;
+    constexpr Ref(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Reference an object of an arena.
+     * @param a Arena whose initial buffer holds p.
+     * @param p Object to reference, or nullptr.
+     */
+    [[nodiscard]] static Ref to(const Arena &a, const T *p) noexcept
+    {
+      if (!p)
+        return Ref{};
+
+      assert(a.owns(p) && "Ref target is not owned by the arena");
+      const std::span<const std::byte> buf = a.buffer();
+      const auto *b = reinterpret_cast<const std::byte *>(p);
+      assert(b >= buf.data() && b < buf.data() + buf.size() && "Ref target is in a chained block");
+
+      const auto offset = static_cast<std::size_t>(b - buf.data());
+      assert(offset <= max_offset && "Ref target offset does not fit the offset type");
+      (void)buf;
+
+      Ref r;
+      r.value_ = static_cast<Offset>(offset + 1);
+      return r;
+    }
+
+    /// @return The object in a, or nullptr.
+    [[nodiscard]] T *get(Arena &a) const noexcept
+    {
+      T *p = get(a.buffer().data());
+      assert((!p || a.owns(p)) && "Ref resolved outside the arena");
+      return p;
+    }
+
+    [[nodiscard]] const T *get(const Arena &a) const noexcept
+    {
+      const T *p = get(a.buffer().data());
+      assert((!p || a.owns(p)) && "Ref resolved outside the arena");
+      return p;
+    }
+
+    /**
+     * @brief Resolve against a copy of the arena's buffer.
+     * @param base Start of the copy (e.g. MappedSnapshot::data()).
+     */
+    [[nodiscard]] T *get(std::byte *base) const noexcept
+    {
+      return value_ ? reinterpret_cast<T *>(base + (value_ - 1)) : nullptr;
+    }
+
+    [[nodiscard]] const T *get(const std::byte *base) const noexcept
+    {
+      return value_ ? reinterpret_cast<const T *>(base + (value_ - 1)) : nullptr;
+    }
+
+    explicit constexpr operator bool() const noexcept { return value_ != 0; }
+
+    /// @return Byte offset of the object from the buffer's start (null: undefined).
+    [[nodiscard]] constexpr std::size_t offset() const noexcept { return std::size_t{value_} - 1; }
+
+    [[nodiscard]] friend constexpr bool operator==(Ref a, Ref b) noexcept { return a.value_ == b.value_; }
+    [[nodiscard]] friend constexpr bool operator==(Ref a, std::nullptr_t) noexcept { return !a; }
+
+  private:
+    Offset value_ = 0;
+  };
+} // namespace arena
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace arena
+{
+  /**
+   * @brief Self-relative pointer: stores the distance from itself to the target.
+   *
+   * A structure whose internal links are RelPtr can be copied byte-for-byte
+   * to another address (written to a snapshot file, mapped into another
+   * process, ...) and its links stay valid, as long as the pointer and its
+   * target move together.
+   *
+   * @code
+   * struct Node
+   * {
+   *   int value;
+   *   arena::RelPtr<Node> next;
+   * };
+   * @endcode
+   *
+   * Copying a RelPtr re-targets the copy at the same object, so it behaves
+   * like a plain T* in ordinary code. An offset of 0 means null.
+   *
+   * @tparam Offset Signed integer type holding the distance. A narrower type
+   *         (e.g. std::int32_t) makes the pointer smaller but limits how far
+   *         apart it and its target may be; this is debug-asserted.
+   */
+  template <class T, class Offset = std::ptrdiff_t>
+  class RelPtr
+  {
+    static_assert(std::is_integral_v<Offset> && std::is_signed_v<Offset>,
+                  "RelPtr offsets must be a signed integer type");
+
+  public:
+    using element_type = T;
+    using offset_type = Offset;
+
+    RelPtr() noexcept = default;
+    RelPtr(std::nullptr_t) noexcept {}
+    RelPtr(T *p) noexcept { set(p); }
+    RelPtr(const RelPtr &other) noexcept { set(other.get()); }
+
+    RelPtr &operator=(const RelPtr &other) noexcept
+    {
+      set(other.get());
+      return *this;
+    }
+
+    RelPtr &operator=(T *p) noexcept
+    {
+      set(p);
+      return *this;
+    }
+
+    /// @return The target, or nullptr.
+    [[nodiscard]] T *get() const noexcept
+    {
+      if (offset_ == 0)
+        return nullptr;
+      return reinterpret_cast<T *>(reinterpret_cast<std::uintptr_t>(this) + static_cast<std::uintptr_t>(offset_));
+    }
+
+    [[nodiscard]] T &operator*() const noexcept { return *get(); }
+    [[nodiscard]] T *operator->() const noexcept { return get(); }
+    [[nodiscard]] T &operator[](std::size_t i) const noexcept { return get()[i]; }
+
+    explicit operator bool() const noexcept { return offset_ != 0; }
+
+    /// @return The stored distance in bytes (0 for null).
+    [[nodiscard]] Offset offset() const noexcept { return offset_; }
+
+    [[nodiscard]] friend bool operator==(const RelPtr &a, const RelPtr &b) noexcept { return a.get() == b.get(); }
+    [[nodiscard]] friend bool operator==(const RelPtr &a, std::nullptr_t) noexcept { return !a; }
+
+  private:
+    void set(T *p) noexcept
+    {
+      if (!p)
+      {
+        offset_ = 0;
+        return;
+      }
+
+      const auto d = static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(p) - reinterpret_cast<std::uintptr_t>(this));
+      assert(d >= std::numeric_limits<Offset>::min() && d <= std::numeric_limits<Offset>::max() &&
+             "RelPtr target too far away for its offset type");
+      offset_ = static_cast<Offset>(d);
+    }
+
+    Offset offset_ = 0;
+  };
+} // namespace arena
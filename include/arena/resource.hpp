@@ -0,0 +1,64 @@
+#pragma once
+
+#include <arena/arena.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace arena
+{
+  /**
+   * @brief std::pmr::memory_resource adapter for Arena.
+   *
+   * Lets pmr containers (std::pmr::vector, std::pmr::string,
+   * std::pmr::unordered_map, ...) allocate from an Arena, so a whole
+   * container graph is freed with a single reset() or rewind().
+   *
+   * @code
+   * arena::Arena a(1 << 20);
+   * arena::Resource res(a);
+   * std::pmr::vector<int> v(&res);
+   * v.push_back(1);
+   * @endcode
+   *
+   * Deallocating the arena's most recent allocation gives its bytes back
+   * (Arena::try_deallocate()); anything else comes back when the arena is
+   * reset or rewound. Containers must not be used after that point.
+   *
+   * @note Like Arena, this resource is not thread-safe.
+   */
+  class Resource final : public std::pmr::memory_resource
+  {
+  public:
+    /**
+     * @brief Wrap an arena.
+     * @param a Arena to allocate from. Must outlive the resource.
+     */
+    explicit Resource(Arena &a) noexcept : arena_(&a) {}
+
+    /// @return The wrapped arena.
+    [[nodiscard]] Arena &arena() const noexcept { return *arena_; }
+
+  protected:
+    /// @throws std::bad_alloc If the arena is exhausted.
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      return arena_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t) override
+    {
+      (void)arena_->try_deallocate(p, bytes);
+    }
+
+    /// @return True if other is a Resource over the same arena.
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+      const auto *r = dynamic_cast<const Resource *>(&other);
+      return r && r->arena_ == arena_;
+    }
+
+  private:
+    Arena *arena_;
+  };
+} // namespace arena
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <arena/arena.hpp>
+#include <arena/pool.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace arena
+{
+  /**
+   * @brief Occupancy of one size class of a SizeClassAllocator.
+   */
+  struct SizeClassStats
+  {
+    /// @brief Slot size of the class in bytes.
+    std::size_t slot_size = 0;
+
+    /// @brief Slots currently handed out.
+    std::size_t live = 0;
+
+    /// @brief Freed slots waiting for reuse.
+    std::size_t free_slots = 0;
+
+    /// @brief Slots obtained from the arena (live + free + never used).
+    std::size_t capacity = 0;
+
+    /// @brief Chunks obtained from the arena.
+    std::size_t chunks = 0;
+  };
+
+  /**
+   * @brief Slab allocator with power-of-two size classes from 8 to 4096 bytes.
+   *
+   * Sits between the bump arena and malloc: every class is a free-list
+   * pool (see Pool) whose chunks are carved from one Arena, so objects of
+   * similar size stay packed together, nothing goes through the system
+   * allocator, and yet each block can be freed on its own in O(1).
+   *
+   * @code
+   * arena::Arena backing(0, arena::Options{.growth_factor = 1.0, .upstream = &arena::BlockPool::global()});
+   * arena::SizeClassAllocator slab(backing);
+   *
+   * void* p = slab.allocate(200);       // 256-byte class
+   * slab.deallocate(p, 200);           // back on that class's free list
+   * auto* s = slab.make<Session>(id);
+   * slab.destroy(s);
+   * @endcode
+   *
+   * deallocate() needs the size (and alignment) the block was allocated
+   * with, like sized operator delete. Requests above max_size, or aligned
+   * to more than cache_line_size, are bumped straight from the arena; they
+   * are reclaimed only when they are its most recent allocation, otherwise
+   * on the arena's reset.
+   *
+   * @warning The arena must not be reset or rewound past the allocator's
+   *          chunks while it is in use.
+   * @note Not thread-safe.
+   */
+  class SizeClassAllocator final
+  {
+  public:
+    /// @brief Smallest size class.
+    static constexpr std::size_t min_size = 8;
+
+    /// @brief Largest size class.
+    static constexpr std::size_t max_size = 4096;
+
+    /// @brief Number of size classes (8, 16, ..., 4096).
+    static constexpr std::size_t class_count = 10;
+
+    static_assert((min_size << (class_count - 1)) == max_size, "size classes must end at max_size");
+
+    /// @brief Default bytes requested from the arena per chunk.
+    static constexpr std::size_t default_chunk_bytes = std::size_t{64} << 10;
+
+    /**
+     * @brief Create an allocator over an arena.
+     * @param a Arena to carve chunks from. Must outlive the allocator.
+     * @param chunk_bytes Approximate bytes per chunk, shared by all classes
+     *        (every chunk holds at least one slot).
+     */
+    explicit SizeClassAllocator(Arena &a, std::size_t chunk_bytes = default_chunk_bytes) noexcept
+        : arena_(&a), classes_(make_classes(a, chunk_bytes, std::make_index_sequence<class_count>{}))
+    {
+    }
+
+    SizeClassAllocator(const SizeClassAllocator &) = delete;
+    SizeClassAllocator &operator=(const SizeClassAllocator &) = delete;
+
+    /// @return Slot size of a size class.
+    [[nodiscard]] static constexpr std::size_t class_size(std::size_t index) noexcept { return min_size << index; }
+
+    /**
+     * @return Index of the size class serving size bytes at the given
+     *         alignment, or class_count if the request bypasses the classes.
+     */
+    [[nodiscard]] static constexpr std::size_t class_of(std::size_t size,
+                                                        std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+      if (size < alignment)
+        size = alignment;
+      if (size > max_size || alignment > cache_line_size)
+        return class_count;
+      if (size <= min_size)
+        return 0;
+      return static_cast<std::size_t>(std::bit_width(size - 1)) - 3;
+    }
+
+    /**
+     * @brief Allocate a block.
+     * @param size Requested size in bytes (0 is treated as 1).
+     * @param alignment Requested alignment (must be a power of two).
+     * @return The block, or nullptr if the arena is exhausted or alignment
+     *         is invalid.
+     */
+    [[nodiscard]] void *try_allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+      if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+        return nullptr;
+
+      const std::size_t c = class_of(size == 0 ? 1 : size, alignment);
+      if (c == class_count)
+        return arena_->try_allocate(size, alignment);
+      return classes_[c].try_allocate();
+    }
+
+    /**
+     * @brief Allocate a block.
+     * @return The block.
+     * @throws std::bad_alloc If the arena is exhausted or alignment is invalid.
+     * @see try_allocate()
+     */
+    [[nodiscard]] void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+      void *p = try_allocate(size, alignment);
+      if (!p)
+        throw std::bad_alloc{};
+      return p;
+    }
+
+    /**
+     * @brief Free a block in O(1).
+     * @param p Block from allocate()/try_allocate() (nullptr is ignored).
+     * @param size Size passed to allocate().
+     * @param alignment Alignment passed to allocate().
+     */
+    void deallocate(void *p, std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+      if (!p)
+        return;
+
+      const std::size_t c = class_of(size == 0 ? 1 : size, alignment);
+      if (c == class_count)
+        (void)arena_->try_deallocate(p, size);
+      else
+        classes_[c].deallocate(p);
+    }
+
+    /**
+     * @brief Construct an object in its size class.
+     * @return Pointer to the new object.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    template <class T, class... Args>
+    [[nodiscard]] T *make(Args &&...args)
+    {
+      static_assert(!std::is_void_v<T>, "T must not be void");
+      void *mem = allocate(sizeof(T), alignof(T));
+
+      if constexpr (std::is_nothrow_constructible_v<T, Args &&...>)
+      {
+        return ::new (mem) T(std::forward<Args>(args)...);
+      }
+      else
+      {
+        try
+        {
+          return ::new (mem) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+          deallocate(mem, sizeof(T), alignof(T));
+          throw;
+        }
+      }
+    }
+
+    /**
+     * @brief Destroy an object created with make() and free its slot.
+     * @param p Object to destroy (nullptr is ignored).
+     */
+    template <class T>
+    void destroy(T *p) noexcept
+    {
+      if (!p)
+        return;
+
+      p->~T();
+      deallocate(p, sizeof(T), alignof(T));
+    }
+
+    /// @return Occupancy of one size class.
+    [[nodiscard]] SizeClassStats stats(std::size_t index) const noexcept
+    {
+      const detail::SlotPool &pool = classes_[index];
+      SizeClassStats s;
+      s.slot_size = pool.slot_size();
+      s.live = pool.live();
+      s.free_slots = pool.free_slots();
+      s.capacity = pool.capacity();
+      s.chunks = pool.chunk_count();
+      return s;
+    }
+
+    /// @return Occupancy of every size class, smallest first.
+    [[nodiscard]] std::array<SizeClassStats, class_count> stats() const noexcept
+    {
+      std::array<SizeClassStats, class_count> all;
+      for (std::size_t i = 0; i < class_count; ++i)
+        all[i] = stats(i);
+      return all;
+    }
+
+    /// @return Bytes in live slots, over all classes.
+    [[nodiscard]] std::size_t live_bytes() const noexcept
+    {
+      std::size_t n = 0;
+      for (const detail::SlotPool &pool : classes_)
+        n += pool.live() * pool.slot_size();
+      return n;
+    }
+
+    /// @return True if p points into a slot of any class.
+    [[nodiscard]] bool owns(const void *p) const noexcept
+    {
+      for (const detail::SlotPool &pool : classes_)
+      {
+        if (pool.owns(p))
+          return true;
+      }
+      return false;
+    }
+
+    /// @return The arena chunks are carved from.
+    [[nodiscard]] Arena &arena() const noexcept { return *arena_; }
+
+  private:
+    template <std::size_t... I>
+    static std::array<detail::SlotPool, class_count> make_classes(Arena &a, std::size_t chunk_bytes,
+                                                                  std::index_sequence<I...>) noexcept
+    {
+      return {{detail::SlotPool(a, class_size(I), slot_alignment(I), chunk_bytes / class_size(I))...}};
+    }
+
+    // Natural alignment up to a cache line, so the chunk header stays small.
+    static constexpr std::size_t slot_alignment(std::size_t index) noexcept
+    {
+      return class_size(index) < cache_line_size ? class_size(index) : cache_line_size;
+    }
+
+    Arena *arena_;
+    std::array<detail::SlotPool, class_count> classes_;
+  };
+} // namespace arena
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <arena/arena.hpp>
+#include <arena/detail/poison.hpp>
+#include <arena/detail/vm.hpp>
+#include <arena/rel_ptr.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <utility>
+
+namespace arena
+{
+  /**
+   * @brief File header written in front of a snapshot image.
+   *
+   * The image (the arena's [0, used()) bytes) starts header_size bytes into
+   * the file, so a read-only mapping of the file keeps it 64-byte aligned.
+   */
+  struct SnapshotHeader
+  {
+    /// @brief Expected magic bytes.
+    static constexpr char expected_magic[8] = {'A', 'R', 'E', 'N', 'A', 'S', 'N', 'P'};
+
+    /// @brief Current format version.
+    static constexpr std::uint32_t current_version = 1;
+
+    /// @brief Marker used to reject images written on a different byte order.
+    static constexpr std::uint32_t byte_order_marker = 0x01020304u;
+
+    /// @brief Root offset meaning "no root object".
+    static constexpr std::uint64_t no_root = ~std::uint64_t{0};
+
+    char magic[8] = {};
+    std::uint32_t version = 0;
+    std::uint32_t header_size = 0;
+    std::uint64_t size = 0;
+    std::uint64_t root = no_root;
+    std::uint32_t byte_order = 0;
+    std::uint32_t alignment = 0;
+    std::uint32_t pointer_size = 0;
+    std::uint8_t reserved[20] = {};
+  };
+
+  static_assert(sizeof(SnapshotHeader) == 64, "snapshot header must stay 64 bytes");
+
+  /**
+   * @brief Write an arena's contents to a snapshot file.
+   * @param a Arena to save. Must hold everything in its initial buffer
+   *        (see Arena::contents()); a growable arena that chained blocks,
+   *        or one with live overflow allocations (Options::overflow),
+   *        cannot be saved.
+   * @param path Destination file, overwritten.
+   * @param root Optional object inside the arena that MappedSnapshot::root()
+   *        returns after loading.
+   * @return False if the arena chained blocks or holds overflow
+   *         allocations, root lies outside its contents, or the file
+   *         cannot be written.
+   *
+   * The bytes are copied verbatim, so the structure must be position
+   * independent: link objects with RelPtr (or Ref), never raw pointers,
+   * and store no owning types (std::string, std::vector, ...) whose data
+   * lives outside the arena. RelPtr itself is not trivially copyable, on
+   * purpose: its copy re-targets the same object, while the bytes copied
+   * here keep their offsets valid because the whole range moves at once.
+   *
+   * @note With ARENA_ENABLE_POISONING, the saved range is unpoisoned first
+   *       so its redzones can be read; they are not checked again afterwards.
+   */
+  [[nodiscard]] inline bool save_snapshot(const Arena &a, const char *path, const void *root = nullptr) noexcept
+  {
+    const std::span<const std::byte> bytes = a.contents();
+    if (bytes.size() != a.used() || a.overflow_bytes() != 0)
+      return false;
+
+    SnapshotHeader h;
+    std::memcpy(h.magic, SnapshotHeader::expected_magic, sizeof(h.magic));
+    h.version = SnapshotHeader::current_version;
+    h.header_size = sizeof(SnapshotHeader);
+    h.size = bytes.size();
+    h.byte_order = SnapshotHeader::byte_order_marker;
+    h.pointer_size = sizeof(void *);
+
+    // Offsets keep their alignment only up to that of the buffer's base.
+    const auto base = reinterpret_cast<std::uintptr_t>(bytes.data());
+    const std::uintptr_t base_align = base ? (base & (~base + 1)) : sizeof(SnapshotHeader);
+    h.alignment = static_cast<std::uint32_t>(base_align < sizeof(SnapshotHeader) ? base_align : sizeof(SnapshotHeader));
+
+    if (root)
+    {
+      const auto r = reinterpret_cast<std::uintptr_t>(root);
+      if (r < base || r - base >= bytes.size())
+        return false;
+      h.root = r - base;
+    }
+
+    std::FILE *f = std::fopen(path, "wb");
+    if (!f)
+      return false;
+
+    detail::unpoison_region(bytes.data(), bytes.size());
+    bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1;
+    if (ok && !bytes.empty())
+      ok = std::fwrite(bytes.data(), bytes.size(), 1, f) == 1;
+    if (std::fclose(f) != 0)
+      ok = false;
+    return ok;
+  }
+
+  /**
+   * @brief Read-only view of a snapshot file, mapped straight into memory.
+   *
+   * Opening a snapshot maps the file with mmap (MapViewOfFile on Windows)
+   * and validates the header; nothing is parsed or copied, so loading is
+   * constant time and pages are faulted in as they are read. The mapping
+   * is shared: several processes opening the same file share its pages in
+   * the page cache.
+   *
+   * @code
+   * // writer
+   * arena::Arena a(1 << 20);
+   * Index* idx = build_index(a); // links are arena::RelPtr
+   * if (!arena::save_snapshot(a, "index.bin", idx))
+   *   fail();
+   *
+   * // reader, possibly another process
+   * auto snap = arena::MappedSnapshot::open("index.bin");
+   * if (const Index* idx = snap.root<Index>())
+   *   lookup(*idx);
+   * @endcode
+   *
+   * The image is mapped 64-byte aligned; objects keep their alignment up
+   * to alignment() (the alignment of the saved arena's buffer, at most 64).
+   * The memory is read-only: writing through it faults.
+   */
+  class MappedSnapshot final
+  {
+  public:
+    /// @brief An empty, invalid snapshot.
+    MappedSnapshot() noexcept = default;
+
+    ~MappedSnapshot() { close(); }
+
+    MappedSnapshot(const MappedSnapshot &) = delete;
+    MappedSnapshot &operator=(const MappedSnapshot &) = delete;
+
+    MappedSnapshot(MappedSnapshot &&other) noexcept { take(other); }
+
+    MappedSnapshot &operator=(MappedSnapshot &&other) noexcept
+    {
+      if (this != &other)
+      {
+        close();
+        take(other);
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Map a snapshot file written by save_snapshot().
+     * @param path File to open.
+     * @return The mapped snapshot, or an invalid one (operator bool is false)
+     *         if the file cannot be mapped or is not a compatible snapshot.
+     */
+    [[nodiscard]] static MappedSnapshot open(const char *path) noexcept
+    {
+      MappedSnapshot s;
+      std::size_t bytes = 0;
+      const void *map = detail::vm::map_file(path, bytes);
+      if (!map)
+        return s;
+
+      s.map_ = map;
+      s.map_size_ = bytes;
+
+      SnapshotHeader h;
+      if (bytes < sizeof(h))
+      {
+        s.close();
+        return s;
+      }
+      std::memcpy(&h, map, sizeof(h));
+
+      const bool valid = std::memcmp(h.magic, SnapshotHeader::expected_magic, sizeof(h.magic)) == 0 &&
+                         h.version == SnapshotHeader::current_version &&
+                         h.header_size == sizeof(SnapshotHeader) &&
+                         h.byte_order == SnapshotHeader::byte_order_marker &&
+                         h.pointer_size == sizeof(void *) &&
+                         h.size <= bytes - sizeof(h) &&
+                         (h.root == SnapshotHeader::no_root || h.root < h.size);
+      if (!valid)
+      {
+        s.close();
+        return s;
+      }
+
+      s.data_ = static_cast<const std::byte *>(map) + sizeof(h);
+      s.size_ = static_cast<std::size_t>(h.size);
+      s.root_ = h.root;
+      s.alignment_ = h.alignment;
+      return s;
+    }
+
+    /// @return True if a snapshot is mapped.
+    explicit operator bool() const noexcept { return data_ != nullptr; }
+
+    /// @return Start of the image (offset 0 of the saved arena).
+    [[nodiscard]] const std::byte *data() const noexcept { return data_; }
+
+    /// @return Size of the image (used() of the saved arena).
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /// @return The image as a byte span.
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+
+    /// @return Alignment preserved for objects in the image.
+    [[nodiscard]] std::size_t alignment() const noexcept { return alignment_; }
+
+    /**
+     * @return The root object passed to save_snapshot(), or nullptr if none
+     *         was given or the snapshot is invalid.
+     */
+    template <class T>
+    [[nodiscard]] const T *root() const noexcept
+    {
+      if (!data_ || root_ == SnapshotHeader::no_root)
+        return nullptr;
+      return reinterpret_cast<const T *>(data_ + root_);
+    }
+
+    /**
+     * @brief Access an object by its offset in the saved arena.
+     * @param offset Byte offset from the start of the image.
+     * @return The object, or nullptr if a T at offset would not fit.
+     */
+    template <class T>
+    [[nodiscard]] const T *at(std::size_t offset) const noexcept
+    {
+      if (!data_ || offset > size_ || sizeof(T) > size_ - offset)
+        return nullptr;
+      return reinterpret_cast<const T *>(data_ + offset);
+    }
+
+    /// @return True if p points into the image.
+    [[nodiscard]] bool owns(const void *p) const noexcept
+    {
+      const auto *b = static_cast<const std::byte *>(p);
+      return data_ && b >= data_ && b < data_ + size_;
+    }
+
+    /// @brief Unmap the file; the snapshot becomes invalid.
+    void close() noexcept
+    {
+      detail::vm::unmap_file(map_, map_size_);
+      map_ = nullptr;
+      map_size_ = 0;
+      data_ = nullptr;
+      size_ = 0;
+      root_ = SnapshotHeader::no_root;
+      alignment_ = 0;
+    }
+
+  private:
+    void take(MappedSnapshot &other) noexcept
+    {
+      map_ = std::exchange(other.map_, nullptr);
+      map_size_ = std::exchange(other.map_size_, 0);
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      root_ = std::exchange(other.root_, SnapshotHeader::no_root);
+      alignment_ = std::exchange(other.alignment_, 0);
+    }
+
+    const void *map_ = nullptr;
+    std::size_t map_size_ = 0;
+    const std::byte *data_ = nullptr;
+    std::size_t size_ = 0;
+    std::uint64_t root_ = SnapshotHeader::no_root;
+    std::size_t alignment_ = 0;
+  };
+} // namespace arena
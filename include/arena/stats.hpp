@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Set to 1 to make Arena collect allocation statistics.
+ *
+ * Off by default, in which case the counters are compiled out entirely and
+ * Arena::stats() returns zeros. The setting changes Arena's layout, so it
+ * must be the same in every translation unit of a program (the CMake option
+ * ARENA_ENABLE_STATS defines it for all arena::arena consumers).
+ */
+#ifndef ARENA_ENABLE_STATS
+#define ARENA_ENABLE_STATS 0
+#endif
+
+namespace arena
+{
+  /**
+   * @brief Snapshot of an arena's allocation statistics.
+   *
+   * Cheap to copy. Snapshots from several arenas (e.g. one per thread) can
+   * be aggregated with operator+=; every field is summed, so the combined
+   * peak_used is the footprint if all arenas peaked at the same time.
+   */
+  struct Stats
+  {
+    /// @brief Highest used() seen since construction or reset_stats().
+    std::size_t peak_used = 0;
+
+    /// @brief Number of successful allocations.
+    std::size_t allocations = 0;
+
+    /// @brief Bytes skipped to satisfy alignment.
+    std::size_t padding_bytes = 0;
+
+    /// @brief Number of allocation requests that returned nullptr.
+    std::size_t failed_allocations = 0;
+
+    /// @brief Number of rewind() calls that took effect (Scope included).
+    std::size_t rewinds = 0;
+
+    /// @brief Number of reset() calls.
+    std::size_t resets = 0;
+
+    /// @brief Blocks in use when the snapshot was taken (growable arenas).
+    std::size_t blocks = 0;
+
+    /// @brief Allocations served by Options::overflow (also counted in allocations).
+    std::size_t overflows = 0;
+
+    Stats &operator+=(const Stats &other) noexcept
+    {
+      peak_used += other.peak_used;
+      allocations += other.allocations;
+      padding_bytes += other.padding_bytes;
+      failed_allocations += other.failed_allocations;
+      rewinds += other.rewinds;
+      resets += other.resets;
+      blocks += other.blocks;
+      overflows += other.overflows;
+      return *this;
+    }
+
+    [[nodiscard]] friend Stats operator+(Stats lhs, const Stats &rhs) noexcept
+    {
+      lhs += rhs;
+      return lhs;
+    }
+  };
+} // namespace arena
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <arena/arena.hpp>
+#include <arena/flat_map.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <string_view>
+
+namespace arena
+{
+  /**
+   * @brief Non-owning, immutable string whose characters usually live in an Arena.
+   *
+   * A String is a pointer and a length, like std::string_view, so it is
+   * trivially copyable and destructible and is dropped with the arena at no
+   * cost. copy() allocates a NUL-terminated copy in an arena; constructing a
+   * String from a string_view only references the caller's characters.
+   *
+   * @code
+   * arena::Arena a(1 << 16);
+   * arena::String name = arena::String::copy(a, "content-type");
+   * std::puts(name.c_str());
+   * @endcode
+   */
+  class String
+  {
+  public:
+    constexpr String() noexcept = default;
+
+    /// @brief Reference existing characters without copying them.
+    constexpr String(std::string_view s) noexcept : data_(s.data()), size_(s.size()) {}
+
+    /**
+     * @brief Copy characters into an arena.
+     * @param a Arena to allocate from.
+     * @param s Characters to copy.
+     * @return A NUL-terminated String owned by the arena.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    [[nodiscard]] static String copy(Arena &a, std::string_view s)
+    {
+      if (s.size() == std::numeric_limits<std::size_t>::max())
+        throw std::bad_alloc{};
+
+      char *p = static_cast<char *>(a.allocate<1>(s.size() + 1));
+      if (!s.empty())
+        std::memcpy(p, s.data(), s.size());
+      p[s.size()] = '\0';
+      return String(p, s.size());
+    }
+
+    /**
+     * @brief Concatenate two strings into an arena.
+     * @return A NUL-terminated String owned by the arena.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    [[nodiscard]] static String concat(Arena &a, std::string_view lhs, std::string_view rhs)
+    {
+      if (lhs.size() >= std::numeric_limits<std::size_t>::max() - rhs.size())
+        throw std::bad_alloc{};
+
+      char *p = static_cast<char *>(a.allocate<1>(lhs.size() + rhs.size() + 1));
+      if (!lhs.empty())
+        std::memcpy(p, lhs.data(), lhs.size());
+      if (!rhs.empty())
+        std::memcpy(p + lhs.size(), rhs.data(), rhs.size());
+      p[lhs.size() + rhs.size()] = '\0';
+      return String(p, lhs.size() + rhs.size());
+    }
+
+    /// @return Pointer to the characters (not NUL-terminated unless created by copy()/concat()).
+    [[nodiscard]] constexpr const char *data() const noexcept { return data_; }
+
+    /// @return Pointer to the NUL-terminated characters of a copy()/concat() result.
+    [[nodiscard]] constexpr const char *c_str() const noexcept { return data_ ? data_ : ""; }
+
+    /// @return Number of characters.
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return size_; }
+
+    /// @return True if the string is empty.
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] constexpr char operator[](std::size_t i) const noexcept { return data_[i]; }
+
+    [[nodiscard]] constexpr const char *begin() const noexcept { return data_; }
+    [[nodiscard]] constexpr const char *end() const noexcept { return data_ + size_; }
+
+    /// @return The characters as a string_view.
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return {data_, size_}; }
+
+    constexpr operator std::string_view() const noexcept { return view(); }
+
+    [[nodiscard]] friend constexpr bool operator==(const String &a, const String &b) noexcept
+    {
+      return a.view() == b.view();
+    }
+
+    [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const String &a, const String &b) noexcept
+    {
+      return a.view() <=> b.view();
+    }
+
+  private:
+    constexpr String(const char *p, std::size_t n) noexcept : data_(p), size_(n) {}
+
+    const char *data_ = nullptr;
+    std::size_t size_ = 0;
+  };
+} // namespace arena
+
+template <>
+struct std::hash<arena::String>
+{
+  [[nodiscard]] std::size_t operator()(const arena::String &s) const noexcept
+  {
+    return std::hash<std::string_view>{}(s.view());
+  }
+};
+
+namespace arena
+{
+  /**
+   * @brief String interning table backed by an Arena.
+   *
+   * Each distinct string is copied into the arena once; interning an equal
+   * string again returns the same String (same data() pointer), so interned
+   * strings can be compared by pointer. Every interned string also gets a
+   * dense id in insertion order, handy for symbol tables.
+   *
+   * @code
+   * arena::Interner names(a);
+   * arena::String k1 = names.intern("host");
+   * arena::String k2 = names.intern(std::string("host"));
+   * assert(k1.data() == k2.data());
+   * @endcode
+   *
+   * @note Not thread-safe. Interned strings live until the arena is reset.
+   */
+  class Interner
+  {
+  public:
+    /**
+     * @brief Create an empty table.
+     * @param a Arena to copy strings and the table into. Must outlive the table.
+     */
+    explicit Interner(Arena &a) noexcept : arena_(&a), ids_(a) {}
+
+    Interner(const Interner &) = delete;
+    Interner &operator=(const Interner &) = delete;
+
+    /**
+     * @brief Return the canonical copy of s, copying it on first use.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    [[nodiscard]] String intern(std::string_view s) { return entry(s).key; }
+
+    /**
+     * @brief Intern s and return its dense id (0, 1, 2, ... in insertion order).
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    [[nodiscard]] std::uint32_t id(std::string_view s) { return entry(s).value; }
+
+    /// @return True if s has been interned.
+    [[nodiscard]] bool contains(std::string_view s) const noexcept { return ids_.contains(String(s)); }
+
+    /// @return Number of distinct strings interned.
+    [[nodiscard]] std::size_t size() const noexcept { return ids_.size(); }
+
+    /// @return The arena strings are copied into.
+    [[nodiscard]] Arena &arena() const noexcept { return *arena_; }
+
+  private:
+    using Map = FlatMap<String, std::uint32_t>;
+
+    Map::Entry &entry(std::string_view s)
+    {
+      // Probe with a non-owning String; copy only on a miss.
+      if (Map::Entry *e = ids_.find_entry(String(s)))
+        return *e;
+
+      const String owned = String::copy(*arena_, s);
+      return *ids_.try_emplace(owned, static_cast<std::uint32_t>(ids_.size())).first;
+    }
+
+    Arena *arena_;
+    Map ids_;
+  };
+} // namespace arena
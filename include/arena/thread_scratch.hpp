@@ -0,0 +1,42 @@
+#pragma once
+
+#include <arena/arena.hpp>
+#include <arena/block_pool.hpp>
+
+namespace arena
+{
+  /**
+   * @brief Return the calling thread's scratch arena.
+   *
+   * Each thread lazily gets its own growable Arena whose blocks come from
+   * BlockPool::global(). Rewinding or resetting it gives blocks back to
+   * the pool (only the largest one stays with the thread for the next
+   * task), so short-lived tasks never hit operator new for scratch memory.
+   *
+   * @code
+   * arena::Arena::Scope scope(arena::thread_scratch());
+   * auto* tmp = arena::thread_scratch().make_array<char>(256);
+   * @endcode
+   */
+  [[nodiscard]] inline Arena &thread_scratch() noexcept
+  {
+    thread_local Arena scratch(0, Options{
+                                      .growth_factor = 1.0,
+                                      .min_block_size = BlockPool::global().block_size() - Arena::block_overhead(),
+                                      .cache_blocks = false,
+                                      .upstream = &BlockPool::global(),
+                                  });
+    return scratch;
+  }
+
+  /**
+   * @brief Return every idle block of the calling thread's scratch arena
+   *        to the global pool.
+   *
+   * Call this from worker threads that are about to go idle.
+   */
+  inline void trim_thread_scratch() noexcept
+  {
+    thread_scratch().trim();
+  }
+} // namespace arena
@@ -0,0 +1,321 @@
+#pragma once
+
+#include <arena/detail/call_site.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arena
+{
+  /**
+   * @brief One traced allocation.
+   */
+  struct TraceEvent
+  {
+    /// @brief Arena that served the allocation.
+    const void *arena = nullptr;
+
+    /// @brief Call site (file, function, line) of the allocating call.
+    const char *file = "";
+    const char *function = "";
+    std::uint32_t line = 0;
+
+    /// @brief Small per-process id of the allocating thread.
+    std::uint32_t thread = 0;
+
+    /// @brief Requested size in bytes.
+    std::size_t size = 0;
+
+    /// @brief Alignment padding spent in front of the block.
+    std::size_t padding = 0;
+
+    /// @brief The arena's used() right after the allocation.
+    std::size_t used = 0;
+
+    /// @brief steady_clock time of the allocation, in nanoseconds.
+    std::uint64_t time_ns = 0;
+  };
+
+  /**
+   * @brief Fixed-size, lock-free ring of TraceEvent.
+   *
+   * Any number of threads can record() concurrently; each takes a slot with
+   * one fetch_add. Once full, the oldest events are overwritten. Readers
+   * (events(), the writers below) skip slots that are being rewritten while
+   * they copy them.
+   *
+   * With ARENA_ENABLE_TRACING every Arena records into global(); the ring
+   * itself can be used (and dumped) in any build.
+   */
+  class TraceRing
+  {
+  public:
+    /// @brief Default number of events kept.
+    static constexpr std::size_t default_capacity = std::size_t{1} << 16;
+
+    /**
+     * @brief Create a ring.
+     * @param capacity Events kept, rounded up to a power of two.
+     * @throws std::bad_alloc If the slots cannot be allocated.
+     */
+    explicit TraceRing(std::size_t capacity = default_capacity)
+        : capacity_(round_up(capacity)), slots_(std::make_unique<Slot[]>(capacity_))
+    {
+    }
+
+    TraceRing(const TraceRing &) = delete;
+    TraceRing &operator=(const TraceRing &) = delete;
+
+    /// @return The ring arenas record into when ARENA_ENABLE_TRACING is set.
+    [[nodiscard]] static TraceRing &global()
+    {
+      static TraceRing ring;
+      return ring;
+    }
+
+    /// @return Maximum number of events kept.
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    /// @return Events recorded since construction or clear().
+    [[nodiscard]] std::uint64_t recorded() const noexcept { return head_.load(std::memory_order_acquire); }
+
+    /// @return Events overwritten because the ring was full.
+    [[nodiscard]] std::uint64_t dropped() const noexcept
+    {
+      const std::uint64_t n = recorded();
+      return n > capacity_ ? n - capacity_ : 0;
+    }
+
+    /**
+     * @brief Append an event.
+     * @param e Event to store. time_ns and thread are filled in when 0.
+     */
+    void record(TraceEvent e) noexcept
+    {
+      if (e.time_ns == 0)
+        e.time_ns = now_ns();
+      if (e.thread == 0)
+        e.thread = thread_id();
+
+      const std::uint64_t index = head_.fetch_add(1, std::memory_order_relaxed);
+      Slot &s = slots_[index & (capacity_ - 1)];
+
+      s.seq.store(0, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      s.arena.store(e.arena, std::memory_order_relaxed);
+      s.file.store(e.file, std::memory_order_relaxed);
+      s.function.store(e.function, std::memory_order_relaxed);
+      s.line_thread.store((std::uint64_t{e.line} << 32) | e.thread, std::memory_order_relaxed);
+      s.size.store(e.size, std::memory_order_relaxed);
+      s.padding.store(e.padding, std::memory_order_relaxed);
+      s.used.store(e.used, std::memory_order_relaxed);
+      s.time_ns.store(e.time_ns, std::memory_order_relaxed);
+      s.seq.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * @return The events currently held, oldest first.
+     * @param arena Only events of this arena (nullptr for all).
+     */
+    [[nodiscard]] std::vector<TraceEvent> events(const void *arena = nullptr) const
+    {
+      const std::uint64_t end = recorded();
+      const std::uint64_t begin = end > capacity_ ? end - capacity_ : 0;
+
+      std::vector<TraceEvent> out;
+      out.reserve(static_cast<std::size_t>(end - begin));
+      for (std::uint64_t i = begin; i < end; ++i)
+      {
+        const Slot &s = slots_[i & (capacity_ - 1)];
+        if (s.seq.load(std::memory_order_acquire) != i + 1)
+          continue;
+
+        TraceEvent e;
+        e.arena = s.arena.load(std::memory_order_relaxed);
+        e.file = s.file.load(std::memory_order_relaxed);
+        e.function = s.function.load(std::memory_order_relaxed);
+        const std::uint64_t lt = s.line_thread.load(std::memory_order_relaxed);
+        e.line = static_cast<std::uint32_t>(lt >> 32);
+        e.thread = static_cast<std::uint32_t>(lt);
+        e.size = s.size.load(std::memory_order_relaxed);
+        e.padding = s.padding.load(std::memory_order_relaxed);
+        e.used = s.used.load(std::memory_order_relaxed);
+        e.time_ns = s.time_ns.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s.seq.load(std::memory_order_relaxed) != i + 1)
+          continue;
+        if (!arena || e.arena == arena)
+          out.push_back(e);
+      }
+      return out;
+    }
+
+    /// @brief Drop every event. Must not race with record().
+    void clear() noexcept
+    {
+      for (std::size_t i = 0; i < capacity_; ++i)
+        slots_[i].seq.store(0, std::memory_order_relaxed);
+      head_.store(0, std::memory_order_release);
+    }
+
+  private:
+    struct Slot
+    {
+      std::atomic<std::uint64_t> seq{0};
+      std::atomic<const void *> arena{nullptr};
+      std::atomic<const char *> file{nullptr};
+      std::atomic<const char *> function{nullptr};
+      std::atomic<std::uint64_t> line_thread{0};
+      std::atomic<std::size_t> size{0};
+      std::atomic<std::size_t> padding{0};
+      std::atomic<std::size_t> used{0};
+      std::atomic<std::uint64_t> time_ns{0};
+    };
+
+    static std::size_t round_up(std::size_t n) noexcept
+    {
+      std::size_t c = 1;
+      while (c < n)
+        c <<= 1;
+      return c;
+    }
+
+    static std::uint64_t now_ns() noexcept
+    {
+      return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                            std::chrono::steady_clock::now().time_since_epoch())
+                                            .count());
+    }
+
+    static std::uint32_t thread_id() noexcept
+    {
+      static std::atomic<std::uint32_t> next{1};
+      thread_local const std::uint32_t id = next.fetch_add(1, std::memory_order_relaxed);
+      return id;
+    }
+
+    std::size_t capacity_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<std::uint64_t> head_{0};
+  };
+
+  namespace detail
+  {
+    // Folded-stack frames are separated by ';' and end at the first space.
+    inline void write_frame(std::ostream &out, const char *s)
+    {
+      for (; *s; ++s)
+        out << (*s == ';' ? ',' : *s == ' ' ? '_' : *s);
+    }
+
+    inline void write_json_string(std::ostream &out, const char *s)
+    {
+      out << '"';
+      for (; *s; ++s)
+      {
+        const char c = *s;
+        if (c == '"' || c == '\\')
+          out << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+          out << ' ';
+        else
+          out << c;
+      }
+      out << '"';
+    }
+  } // namespace detail
+
+  /**
+   * @brief Write allocated bytes per call site in folded-stack format.
+   * @param out Destination stream.
+   * @param ring Ring to read.
+   * @param arena Only events of this arena (nullptr for all).
+   *
+   * One line per call site, "function;file:line bytes", where bytes is the
+   * size plus padding of every event recorded there. Feed it to
+   * flamegraph.pl or speedscope to see who consumes an arena.
+   */
+  inline void write_folded(std::ostream &out, const TraceRing &ring, const void *arena = nullptr)
+  {
+    struct Site
+    {
+      const char *function;
+      const char *file;
+      std::uint32_t line;
+
+      bool operator<(const Site &o) const noexcept
+      {
+        const int f = std::string_view(function).compare(o.function);
+        if (f != 0)
+          return f < 0;
+        const int g = std::string_view(file).compare(o.file);
+        if (g != 0)
+          return g < 0;
+        return line < o.line;
+      }
+    };
+
+    std::map<Site, std::size_t> bytes;
+    for (const TraceEvent &e : ring.events(arena))
+      bytes[Site{e.function, e.file, e.line}] += e.size + e.padding;
+
+    for (const auto &[site, n] : bytes)
+    {
+      detail::write_frame(out, site.function);
+      out << ';';
+      detail::write_frame(out, site.file);
+      out << ':' << site.line << ' ' << n << '\n';
+    }
+  }
+
+  /**
+   * @brief Write events in Chrome trace JSON (chrome://tracing, Perfetto).
+   * @param out Destination stream.
+   * @param ring Ring to read.
+   * @param arena Only events of this arena (nullptr for all).
+   *
+   * Every allocation is an instant event named after its call site, and
+   * each arena's used() is a counter track, so the peak and the calls that
+   * led to it line up on one timeline.
+   */
+  inline void write_chrome_trace(std::ostream &out, const TraceRing &ring, const void *arena = nullptr)
+  {
+    const std::vector<TraceEvent> events = ring.events(arena);
+
+    // Slots are claimed before the clock is read, so across threads ring
+    // order is not time order: start the timeline at the earliest event.
+    std::uint64_t t0 = events.empty() ? 0 : events.front().time_ns;
+    for (const TraceEvent &e : events)
+      t0 = e.time_ns < t0 ? e.time_ns : t0;
+
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const TraceEvent &e : events)
+    {
+      const double ts = static_cast<double>(e.time_ns - t0) / 1000.0;
+      const std::string site = std::string(e.file) + ":" + std::to_string(e.line);
+
+      out << (first ? "\n" : ",\n");
+      first = false;
+      out << "{\"name\":";
+      detail::write_json_string(out, site.c_str());
+      out << ",\"cat\":\"arena\",\"ph\":\"i\",\"s\":\"t\",\"ts\":" << ts << ",\"pid\":1,\"tid\":" << e.thread
+          << ",\"args\":{\"function\":";
+      detail::write_json_string(out, e.function);
+      out << ",\"size\":" << e.size << ",\"padding\":" << e.padding << ",\"used\":" << e.used << "}}";
+
+      out << ",\n{\"name\":\"used\",\"ph\":\"C\",\"ts\":" << ts << ",\"pid\":1,\"args\":{\"arena@" << e.arena
+          << "\":" << e.used << "}}";
+    }
+    out << "\n]}\n";
+  }
+} // namespace arena
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <arena/arena.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace arena
+{
+  /**
+   * @brief Growable array stored in an Arena.
+   *
+   * While its buffer is the most recent allocation in the arena, the vector
+   * grows in place through Arena::try_resize(), so appending leaves no dead
+   * copies behind. Otherwise it moves to a new, larger block like
+   * std::vector (the old block stays dead until the arena is reset).
+   *
+   * @code
+   * arena::Arena a(1 << 16);
+   * arena::Vector<int> v(a);
+   * for (int i = 0; i < 100; ++i)
+   *   v.push_back(i); // grows in place
+   * @endcode
+   *
+   * T must be trivially destructible so the whole vector can be dropped by
+   * reset(), rewind() or Scope at no extra cost; the vector itself has no
+   * destructor to run.
+   *
+   * @note Not thread-safe. Must not be used after its memory is released
+   *       by reset() or rewind().
+   */
+  template <class T>
+  class Vector
+  {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "arena::Vector elements must be trivially destructible");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    /**
+     * @brief Create an empty vector.
+     * @param a Arena to allocate from. Must outlive the vector.
+     */
+    explicit Vector(Arena &a) noexcept : arena_(&a) {}
+
+    /**
+     * @brief Create an empty vector with room for n elements.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    Vector(Arena &a, size_type n) : arena_(&a)
+    {
+      reserve(n);
+    }
+
+    Vector(const Vector &) = delete;
+    Vector &operator=(const Vector &) = delete;
+
+    Vector(Vector &&other) noexcept
+        : arena_(other.arena_), data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)), capacity_(std::exchange(other.capacity_, 0))
+    {
+    }
+
+    Vector &operator=(Vector &&other) noexcept
+    {
+      if (this != &other)
+      {
+        arena_ = other.arena_;
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+      }
+      return *this;
+    }
+
+    /// @return Number of elements.
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+
+    /// @return Number of elements that fit without growing.
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+    /// @return True if the vector has no elements.
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /// @return Pointer to the first element (may be nullptr if empty).
+    [[nodiscard]] T *data() noexcept { return data_; }
+    [[nodiscard]] const T *data() const noexcept { return data_; }
+
+    [[nodiscard]] T &operator[](size_type i) noexcept { return data_[i]; }
+    [[nodiscard]] const T &operator[](size_type i) const noexcept { return data_[i]; }
+
+    [[nodiscard]] T &front() noexcept { return data_[0]; }
+    [[nodiscard]] const T &front() const noexcept { return data_[0]; }
+    [[nodiscard]] T &back() noexcept { return data_[size_ - 1]; }
+    [[nodiscard]] const T &back() const noexcept { return data_[size_ - 1]; }
+
+    [[nodiscard]] iterator begin() noexcept { return data_; }
+    [[nodiscard]] iterator end() noexcept { return data_ + size_; }
+    [[nodiscard]] const_iterator begin() const noexcept { return data_; }
+    [[nodiscard]] const_iterator end() const noexcept { return data_ + size_; }
+
+    /// @return The elements as a span.
+    [[nodiscard]] std::span<T> span() noexcept { return {data_, size_}; }
+    [[nodiscard]] std::span<const T> span() const noexcept { return {data_, size_}; }
+
+    /// @return The arena this vector allocates from.
+    [[nodiscard]] Arena &arena() const noexcept { return *arena_; }
+
+    /**
+     * @brief Ensure capacity for at least n elements.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    void reserve(size_type n)
+    {
+      if (n > capacity_)
+        grow_to(n);
+    }
+
+    /// @brief Append a copy of value.
+    void push_back(const T &value) { emplace_back(value); }
+
+    /// @brief Append value by move.
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    /**
+     * @brief Construct an element at the end.
+     * @return Reference to the new element.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    template <class... Args>
+    T &emplace_back(Args &&...args)
+    {
+      if (size_ == capacity_)
+      {
+        // Construct first: args may refer to an element that grow_to() moves.
+        T tmp(std::forward<Args>(args)...);
+        grow_to(next_capacity());
+        return *::new (static_cast<void *>(data_ + size_++)) T(std::move(tmp));
+      }
+      return *::new (static_cast<void *>(data_ + size_++)) T(std::forward<Args>(args)...);
+    }
+
+    /// @brief Remove the last element (the vector must not be empty).
+    void pop_back() noexcept { --size_; }
+
+    /**
+     * @brief Resize to n elements, value-initializing new ones.
+     * @throws std::bad_alloc If the arena is exhausted.
+     */
+    void resize(size_type n)
+    {
+      reserve(n);
+      for (size_type i = size_; i < n; ++i)
+        ::new (static_cast<void *>(data_ + i)) T();
+      size_ = n;
+    }
+
+    /// @brief Remove all elements; capacity is kept.
+    void clear() noexcept { size_ = 0; }
+
+    /**
+     * @brief Give unused capacity back to the arena if the buffer is on top.
+     *
+     * A no-op otherwise.
+     */
+    void shrink_to_fit() noexcept
+    {
+      if (data_ && size_ < capacity_ &&
+          arena_->try_resize(data_, capacity_ * sizeof(T), size_ * sizeof(T)))
+      {
+        capacity_ = size_;
+        if (size_ == 0)
+          data_ = nullptr;
+      }
+    }
+
+  private:
+    [[nodiscard]] size_type next_capacity() const
+    {
+      constexpr size_type max_count = std::numeric_limits<size_type>::max() / sizeof(T);
+      if (capacity_ > max_count / 2)
+      {
+        if (capacity_ == max_count)
+          throw std::bad_alloc{};
+        return max_count;
+      }
+      return capacity_ == 0 ? initial_capacity : capacity_ * 2;
+    }
+
+    void grow_to(size_type n)
+    {
+      if (n > std::numeric_limits<size_type>::max() / sizeof(T))
+        throw std::bad_alloc{};
+
+      if (data_ && arena_->try_resize(data_, capacity_ * sizeof(T), n * sizeof(T)))
+      {
+        capacity_ = n;
+        return;
+      }
+
+      T *fresh = static_cast<T *>(arena_->allocate<alignof(T)>(n * sizeof(T)));
+      if (size_ != 0)
+        std::uninitialized_move(data_, data_ + size_, fresh);
+      data_ = fresh;
+      capacity_ = n;
+    }
+
+    static constexpr size_type initial_capacity = 64 / sizeof(T) > 4 ? 64 / sizeof(T) : 4;
+
+    Arena *arena_;
+    T *data_ = nullptr;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+  };
+} // namespace arena
@@ -0,0 +1,83 @@
+#include <arena/allocator.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+  static void test_vector()
+  {
+    arena::Arena a(1 << 16);
+    std::vector<int, arena::Allocator<int>> v{arena::Allocator<int>(a)};
+    for (int i = 0; i < 100; ++i)
+      v.push_back(i);
+    assert(a.owns(v.data()));
+    assert(v.back() == 99);
+  }
+
+  static void test_node_containers_are_contiguous()
+  {
+    arena::Arena a(1 << 16);
+    using Alloc = arena::Allocator<std::pair<const int, int>>;
+    std::map<int, int, std::less<int>, Alloc> m{Alloc(a)};
+    for (int i = 0; i < 50; ++i)
+      m.emplace(i, i * i);
+    assert(m.at(7) == 49);
+    assert(a.owns(&*m.find(10)));
+
+    std::list<double, arena::Allocator<double>> l{arena::Allocator<double>(a)};
+    l.push_back(1.0);
+    l.push_back(2.0);
+    const auto *first = reinterpret_cast<const char *>(&l.front());
+    const auto *second = reinterpret_cast<const char *>(&l.back());
+    assert(a.owns(first) && a.owns(second));
+    assert(second > first && second - first < 128);
+  }
+
+  static void test_rebind_and_equality()
+  {
+    arena::Arena a(1024);
+    arena::Arena b(1024);
+
+    arena::Allocator<int> ia(a);
+    arena::Allocator<double> da(ia);
+    assert(&da.arena() == &a);
+    assert(ia == da);
+    assert(ia != arena::Allocator<int>(b));
+
+    using Traits = std::allocator_traits<arena::Allocator<int>>;
+    Traits::rebind_alloc<long> la(ia);
+    long *p = Traits::rebind_traits<long>::allocate(la, 4);
+    assert(a.owns(p));
+    assert(reinterpret_cast<std::uintptr_t>(p) % alignof(long) == 0);
+  }
+
+  static void test_scratch_allocator()
+  {
+    static_assert(sizeof(std::vector<int, arena::ScratchAllocator<int>>) == sizeof(std::vector<int>));
+
+    arena::Arena::Scope scope(arena::thread_scratch());
+    std::unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+                       arena::ScratchAllocator<std::pair<const int, int>>>
+        m;
+    for (int i = 0; i < 100; ++i)
+      m[i] = i;
+    assert(m.at(42) == 42);
+    assert(arena::thread_scratch().owns(&*m.find(3)));
+    assert(arena::ScratchAllocator<int>() == arena::ScratchAllocator<char>());
+  }
+}
+
+int main()
+{
+  test_vector();
+  test_node_containers_are_contiguous();
+  test_rebind_and_equality();
+  test_scratch_allocator();
+  return 0;
+}
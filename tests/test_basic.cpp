@@ -1,11 +1,15 @@
 #include <arena/arena.hpp>
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
 namespace
 {
+  // Poisoning builds put a redzone after every allocation.
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
   struct Foo
   {
     int a;
@@ -60,6 +64,61 @@ namespace
     a.reset();
     assert(a.used() == 0);
   }
+
+  static void test_prefault()
+  {
+    arena::Arena a(1 << 20, arena::Options{.prefault = true});
+    assert(a.capacity() == (1u << 20));
+
+    auto *p = static_cast<std::uint8_t *>(a.allocate(a.capacity() - rz, 1));
+    p[0] = 1;
+    p[a.capacity() - rz - 1] = 2;
+    assert(a.remaining() == 0);
+  }
+
+  static void test_empty_arena()
+  {
+    arena::Arena a;
+    assert(a.capacity() == 0);
+    assert(a.try_allocate(1) == nullptr);
+    assert(!a.owns(nullptr));
+  }
+
+  static void test_static_alignment()
+  {
+    arena::Arena a(1024);
+
+    auto *c = static_cast<char *>(a.allocate<1>(3));
+    assert(a.used() == 3 + rz);
+
+    void *p = a.allocate<16>(8);
+    assert((reinterpret_cast<std::uintptr_t>(p) % 16) == 0);
+    assert(static_cast<char *>(p) >= c + 3);
+
+    void *q = a.try_allocate<64>(0);
+    assert(q && (reinterpret_cast<std::uintptr_t>(q) % 64) == 0);
+
+    assert(a.try_allocate<8>(2048) == nullptr);
+  }
+
+  static void test_make_array_aligned()
+  {
+    arena::Arena a(4096);
+    (void)a.allocate<1>(1);
+
+    float *x = a.make_array_aligned<float>(5);
+    float *y = a.make_array_aligned<float>(5);
+    assert((reinterpret_cast<std::uintptr_t>(x) % arena::cache_line_size) == 0);
+    assert((reinterpret_cast<std::uintptr_t>(y) % arena::cache_line_size) == 0);
+
+    // 20 bytes are padded to a full line: the arrays never share one.
+    assert(reinterpret_cast<char *>(y) - reinterpret_cast<char *>(x) >=
+           static_cast<std::ptrdiff_t>(arena::cache_line_size));
+
+    double *d = a.make_array_aligned<double, 128>(16);
+    assert((reinterpret_cast<std::uintptr_t>(d) % 128) == 0);
+    assert(a.make_array_aligned<int>(0) == nullptr);
+  }
 }
 
 int main()
@@ -67,5 +126,9 @@ int main()
   test_basic_alloc();
   test_make_and_scope();
   test_reset();
+  test_prefault();
+  test_empty_arena();
+  test_static_alignment();
+  test_make_array_aligned();
   return 0;
 }
@@ -0,0 +1,111 @@
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  struct Token
+  {
+    int kind;
+    std::uint32_t pos;
+
+    Token(int k, std::uint32_t p) : kind(k), pos(p) {}
+  };
+
+  static void test_allocate_n()
+  {
+    arena::Arena a(4096);
+    auto *p = static_cast<std::uint8_t *>(a.allocate_n(10, 12, 16));
+    assert((reinterpret_cast<std::uintptr_t>(p) % 16) == 0);
+    assert(a.used() == 10 * 16 + rz);
+    assert(a.owns(p + 9 * 16));
+
+    assert(a.try_allocate_n(0, 8) == nullptr);
+    assert(a.try_allocate_n(8, 8, 3) == nullptr);
+    assert(a.try_allocate_n(SIZE_MAX / 2, 8) == nullptr);
+    assert(a.try_allocate_n(1000, 8) == nullptr);
+  }
+
+  static void test_make_batch_default()
+  {
+    arena::Arena a(4096);
+    std::span<int> xs = a.make_batch<int>(100);
+    assert(xs.size() == 100);
+    for (std::size_t i = 0; i < xs.size(); ++i)
+      xs[i] = static_cast<int>(i);
+    assert(a.owns(&xs.back()));
+    assert(a.make_batch<int>(0).empty());
+  }
+
+  static void test_make_batch_generator()
+  {
+    arena::Arena a(4096);
+    std::span<Token> toks = a.make_batch<Token>(50, [](std::size_t i)
+                                                { return Token(static_cast<int>(i % 3), static_cast<std::uint32_t>(i * 10)); });
+    assert(toks.size() == 50);
+    assert(toks[49].kind == 1 && toks[49].pos == 490);
+    assert(a.used() == 50 * sizeof(Token) + rz);
+  }
+
+  static void test_make_batch_exception_cleans_up()
+  {
+    static int live = 0;
+    struct Counted
+    {
+      explicit Counted(int v)
+      {
+        if (v == 5)
+          throw std::runtime_error("boom");
+        ++live;
+      }
+      ~Counted() { --live; }
+    };
+
+    arena::Arena a(4096);
+    bool threw = false;
+    try
+    {
+      (void)a.make_batch<Counted>(10, [](std::size_t i)
+                                  { return Counted(static_cast<int>(i)); });
+    }
+    catch (const std::runtime_error &)
+    {
+      threw = true;
+    }
+    assert(threw);
+    assert(live == 0);
+  }
+
+  static void test_make_batch_tracked()
+  {
+    static int destroyed = 0;
+    struct Named
+    {
+      std::string name;
+      explicit Named(std::string n) : name(std::move(n)) {}
+      ~Named() { ++destroyed; }
+    };
+
+    arena::Arena a(1 << 16, arena::Options{.track_destructors = true});
+    auto names = a.make_batch<Named>(8, [](std::size_t i)
+                                     { return Named("a name long enough to allocate #" + std::to_string(i)); });
+    assert(names[7].name.back() == '7');
+    a.reset();
+    assert(destroyed == 8);
+  }
+}
+
+int main()
+{
+  test_allocate_n();
+  test_make_batch_default();
+  test_make_batch_generator();
+  test_make_batch_exception_cleans_up();
+  test_make_batch_tracked();
+  return 0;
+}
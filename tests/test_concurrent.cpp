@@ -0,0 +1,112 @@
+#include <arena/concurrent_arena.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  constexpr int kThreads = 8;
+  constexpr int kPerThread = 5000;
+
+  static void run_threads(arena::ConcurrentArena &a, std::vector<std::vector<std::uint64_t *>> &out)
+  {
+    std::vector<std::thread> threads;
+    out.assign(kThreads, {});
+    for (int t = 0; t < kThreads; ++t)
+    {
+      threads.emplace_back([&a, &out, t]
+                           {
+        auto &mine = out[static_cast<std::size_t>(t)];
+        mine.reserve(kPerThread);
+        for (int i = 0; i < kPerThread; ++i)
+        {
+          auto *p = a.make<std::uint64_t>(static_cast<std::uint64_t>(t) << 32 | static_cast<std::uint64_t>(i));
+          mine.push_back(p);
+        } });
+    }
+    for (auto &th : threads)
+      th.join();
+  }
+
+  static void check_distinct(const std::vector<std::vector<std::uint64_t *>> &out)
+  {
+    std::vector<std::uint64_t *> all;
+    for (std::size_t t = 0; t < out.size(); ++t)
+    {
+      for (std::size_t i = 0; i < out[t].size(); ++i)
+      {
+        assert(*out[t][i] == (static_cast<std::uint64_t>(t) << 32 | i));
+        all.push_back(out[t][i]);
+      }
+    }
+    std::sort(all.begin(), all.end());
+    assert(std::adjacent_find(all.begin(), all.end()) == all.end());
+  }
+
+  static void test_fixed_concurrent()
+  {
+    arena::ConcurrentArena a(kThreads * kPerThread * arena::ConcurrentArena::granularity);
+    std::vector<std::vector<std::uint64_t *>> out;
+    run_threads(a, out);
+    check_distinct(out);
+    assert(a.block_count() == 1);
+    assert(a.try_allocate(1) == nullptr);
+  }
+
+  static void test_growable_concurrent()
+  {
+    arena::ConcurrentArena a(1024, arena::Options{.growth_factor = 2.0});
+    std::vector<std::vector<std::uint64_t *>> out;
+    run_threads(a, out);
+    check_distinct(out);
+    assert(a.block_count() > 1);
+    assert(a.owns(out[0][0]));
+    assert(a.used() >= kThreads * kPerThread * sizeof(std::uint64_t));
+
+    const std::size_t largest_before = a.capacity();
+    a.reset();
+    assert(a.block_count() == 1);
+    assert(a.used() == 0);
+    assert(a.capacity() <= largest_before);
+  }
+
+  static void test_over_aligned()
+  {
+    arena::ConcurrentArena a(1 << 20);
+    std::vector<std::thread> threads;
+    std::vector<void *> ptrs(kThreads * 100);
+    for (int t = 0; t < kThreads; ++t)
+    {
+      threads.emplace_back([&, t]
+                           {
+        for (int i = 0; i < 100; ++i)
+        {
+          void *p = (i % 2) ? a.allocate(24, 128) : a.allocate(8);
+          ptrs[static_cast<std::size_t>(t * 100 + i)] = p;
+        } });
+    }
+    for (auto &th : threads)
+      th.join();
+
+    for (std::size_t i = 0; i < ptrs.size(); ++i)
+    {
+      const auto addr = reinterpret_cast<std::uintptr_t>(ptrs[i]);
+      assert(addr % arena::ConcurrentArena::granularity == 0);
+      if (i % 2)
+        assert(addr % 128 == 0);
+    }
+    std::sort(ptrs.begin(), ptrs.end());
+    assert(std::adjacent_find(ptrs.begin(), ptrs.end()) == ptrs.end());
+  }
+}
+
+int main()
+{
+  test_fixed_concurrent();
+  test_growable_concurrent();
+  test_over_aligned();
+  return 0;
+}
@@ -0,0 +1,199 @@
+#include <arena/flat_map.hpp>
+#include <arena/string.hpp>
+#include <arena/vector.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace
+{
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  static void test_vector_grows_in_place()
+  {
+    arena::Arena a(1 << 16);
+    arena::Vector<int> v(a);
+
+    for (int i = 0; i < 1000; ++i)
+      v.push_back(i);
+
+    assert(v.size() == 1000);
+    assert(v.front() == 0 && v.back() == 999);
+    // Growing on top of the arena leaves no dead copies behind.
+    assert(a.used() == v.capacity() * sizeof(int) + rz);
+
+    int sum = 0;
+    for (int x : v)
+      sum += x;
+    assert(sum == 999 * 1000 / 2);
+
+    v.pop_back();
+    v.shrink_to_fit();
+    assert(v.capacity() == 999);
+    assert(a.used() == 999 * sizeof(int) + rz);
+  }
+
+  static void test_vector_relocates_when_not_on_top()
+  {
+    arena::Arena a(1 << 16);
+    arena::Vector<std::uint64_t> v(a, 4);
+    v.push_back(1);
+    v.push_back(2);
+    v.push_back(3);
+    v.push_back(4);
+
+    (void)a.allocate(8);
+    const std::uint64_t *old = v.data();
+    v.push_back(v[0]);
+    assert(v.data() != old);
+    assert(v.size() == 5 && v[4] == 1 && v[3] == 4);
+
+    v.resize(8);
+    assert(v[7] == 0);
+    v.clear();
+    assert(v.empty());
+  }
+
+  static void test_vector_scope()
+  {
+    arena::Arena a(1 << 16);
+    {
+      arena::Arena::Scope scope(a);
+      arena::Vector<float> v(a);
+      v.resize(100);
+      assert(a.used() >= 100 * sizeof(float));
+    }
+    assert(a.used() == 0);
+  }
+
+  static void test_string_copy_and_concat()
+  {
+    arena::Arena a(4096);
+    std::string src = "content";
+    arena::String s = arena::String::copy(a, src);
+    src[0] = 'X';
+    assert(s == arena::String("content"));
+    assert(a.owns(s.data()));
+    assert(std::string_view(s.c_str()) == "content");
+
+    arena::String t = arena::String::concat(a, s, "-type");
+    assert(t.view() == "content-type");
+    assert(t.c_str()[t.size()] == '\0');
+    assert(s < t);
+
+    arena::String empty;
+    assert(empty.empty() && std::string_view(empty.c_str()).empty());
+  }
+
+  static void test_interner()
+  {
+    arena::Arena a(1 << 16);
+    arena::Interner names(a);
+
+    std::string host = "host";
+    arena::String k1 = names.intern(host);
+    arena::String k2 = names.intern("host");
+    assert(k1.data() == k2.data());
+    assert(k1.data() != host.data());
+    assert(names.size() == 1);
+
+    assert(names.id("host") == 0);
+    assert(names.id("accept") == 1);
+    assert(names.id("host") == 0);
+    assert(names.contains("accept"));
+    assert(!names.contains("cookie"));
+
+    for (int i = 0; i < 200; ++i)
+      (void)names.intern("h" + std::to_string(i));
+    assert(names.size() == 202);
+    assert(names.intern("host").data() == k1.data());
+  }
+
+  static void test_flat_map()
+  {
+    arena::Arena a(1 << 20);
+    arena::FlatMap<int, int> m(a);
+
+    for (int i = 0; i < 1000; ++i)
+      m[i] = i * 2;
+    assert(m.size() == 1000);
+    assert(m.capacity() >= 1000);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+      const int *v = m.find(i);
+      assert(v && *v == i * 2);
+    }
+    assert(!m.find(1000));
+
+    auto [e, inserted] = m.try_emplace(5, 99);
+    assert(!inserted && e->value == 10);
+
+    // Looking up existing keys at the load limit neither grows the table
+    // nor takes arena memory.
+    arena::FlatMap<int, int> full(a);
+    int k = 0;
+    full[k++] = 0;
+    while (full.size() + 1 <= full.capacity() - full.capacity() / 4)
+      full[k++] = 0;
+    const std::size_t cap = full.capacity();
+    const std::size_t used = a.used();
+    for (int j = 0; j < k; ++j)
+      ++full[j];
+    assert(full.capacity() == cap && a.used() == used);
+    full[k] = 0;
+    assert(full.capacity() == 2 * cap && full.size() == static_cast<std::size_t>(k) + 1);
+    for (int j = 0; j < k; ++j)
+      assert(*full.find(j) == 1);
+
+    for (int i = 0; i < 1000; i += 2)
+      assert(m.erase(i));
+    assert(!m.erase(0));
+    assert(m.size() == 500);
+    for (int i = 0; i < 1000; ++i)
+      assert(m.contains(i) == (i % 2 == 1));
+
+    std::size_t n = 0;
+    long long sum = 0;
+    for (const auto &entry : m)
+    {
+      ++n;
+      sum += entry.value;
+    }
+    assert(n == 500);
+    assert(sum == 2LL * 250000);
+
+    m.clear();
+    assert(m.empty() && !m.contains(1));
+  }
+
+  static void test_flat_map_string_keys()
+  {
+    arena::Arena a(1 << 16);
+    arena::FlatMap<arena::String, int> headers(a);
+    headers.reserve(64);
+    const std::size_t cap = headers.capacity();
+
+    headers[arena::String::copy(a, "host")] = 1;
+    headers[arena::String::copy(a, "accept")] = 2;
+    assert(headers.capacity() == cap);
+
+    std::string probe = "host";
+    const int *v = headers.find(arena::String(probe));
+    assert(v && *v == 1);
+  }
+}
+
+int main()
+{
+  test_vector_grows_in_place();
+  test_vector_relocates_when_not_on_top();
+  test_vector_scope();
+  test_string_copy_and_concat();
+  test_interner();
+  test_flat_map();
+  test_flat_map_string_keys();
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include <arena/coroutine.hpp>
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace
+{
+  // Minimal lazy task: runs when get() is called, keeps its frame until
+  // the Task is destroyed.
+  struct Task
+  {
+    struct promise_type : arena::ArenaPromise
+    {
+      int value = 0;
+
+      Task get_return_object() { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; }
+      void return_value(int v) noexcept { value = v; }
+      void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit Task(std::coroutine_handle<promise_type> h) noexcept : handle(h) {}
+    Task(Task &&other) noexcept : handle(std::exchange(other.handle, {})) {}
+    Task(const Task &) = delete;
+
+    ~Task()
+    {
+      if (handle)
+        handle.destroy();
+    }
+
+    int get()
+    {
+      handle.resume();
+      return handle.promise().value;
+    }
+
+    std::coroutine_handle<promise_type> handle;
+  };
+
+  static Task add(std::allocator_arg_t, arena::Arena &, int a, int b)
+  {
+    co_return a + b;
+  }
+
+  static Task fib(std::allocator_arg_t, arena::Arena &a, int n)
+  {
+    if (n < 2)
+      co_return n;
+    Task x = fib(std::allocator_arg, a, n - 1);
+    Task y = fib(std::allocator_arg, a, n - 2);
+    co_return x.get() + y.get();
+  }
+
+  static Task scratch_square(int v)
+  {
+    co_return v * v;
+  }
+
+  struct Handler
+  {
+    int base = 100;
+
+    Task handle(std::allocator_arg_t, arena::Arena &, int v)
+    {
+      co_return base + v;
+    }
+  };
+
+  static void test_frame_from_arena()
+  {
+    arena::Arena a(64 * 1024);
+    {
+      Task t = add(std::allocator_arg, a, 2, 3);
+      assert(a.used() > arena::ArenaPromise::header_size);
+      assert(a.owns(t.handle.address()));
+      assert(reinterpret_cast<std::uintptr_t>(t.handle.address()) % arena::ArenaPromise::frame_alignment == 0);
+      assert(t.get() == 5);
+    }
+    // The frame was on top: its bytes went back.
+    assert(a.used() == 0);
+  }
+
+  static void test_nested_frames_unwind()
+  {
+    arena::Arena a(1 << 20);
+    {
+      Task t = fib(std::allocator_arg, a, 12);
+      assert(t.get() == 144);
+    }
+    assert(a.used() == 0);
+  }
+
+  static void test_member_coroutine()
+  {
+    arena::Arena a(4096);
+    Handler h;
+    Task t = h.handle(std::allocator_arg, a, 7);
+    assert(a.owns(t.handle.address()));
+    assert(t.get() == 107);
+  }
+
+  static void test_thread_scratch_fallback()
+  {
+    arena::Arena &scratch = arena::thread_scratch();
+    const std::size_t before = scratch.used();
+    {
+      Task t = scratch_square(9);
+      assert(scratch.owns(t.handle.address()));
+      assert(t.get() == 81);
+    }
+    assert(scratch.used() == before);
+  }
+
+  static void test_out_of_order_destroy()
+  {
+    // A frame destroyed while not on top stays until the arena is reset.
+    arena::Arena a(64 * 1024);
+    auto first = std::make_unique<Task>(add(std::allocator_arg, a, 1, 1));
+    Task second = add(std::allocator_arg, a, 2, 2);
+    const std::size_t used = a.used();
+
+    first.reset();
+    assert(a.used() == used);
+    assert(second.get() == 4);
+  }
+}
+
+int main()
+{
+  test_frame_from_arena();
+  test_nested_frames_unwind();
+  test_member_coroutine();
+  test_thread_scratch_fallback();
+  test_out_of_order_destroy();
+  return 0;
+}
@@ -0,0 +1,148 @@
+#include <arena/allocator.hpp>
+#include <arena/arena.hpp>
+#include <arena/resource.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace
+{
+  static_assert(ARENA_ENABLE_LIFO_CHECKS == 1);
+
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  static std::size_t evaluate(arena::Arena &a, int depth, std::size_t &peak)
+  {
+    void *frame = a.allocate(64, 16);
+    if (a.used() > peak)
+      peak = a.used();
+
+    const std::size_t n = depth == 0 ? 1 : evaluate(a, depth - 1, peak) + evaluate(a, depth - 1, peak);
+    a.deallocate(frame, 64);
+    return n;
+  }
+
+  static void test_lifo_frees()
+  {
+    arena::Arena a(4096);
+    void *p = a.allocate(32, 16);
+    void *q = a.allocate(48, 16);
+    assert(a.used() == 80 + 2 * rz);
+
+    a.deallocate(q, 48);
+    assert(a.used() == 32 + rz);
+    a.deallocate(p, 32);
+    assert(a.used() == 0);
+
+    // The freed bytes are reused.
+    assert(a.allocate(32, 16) == p);
+  }
+
+  static void test_recursive_peak()
+  {
+    // Without deallocate every frame would stay: 2^7 - 1 of them.
+    arena::Arena a(64 * 128);
+    std::size_t peak = 0;
+    const std::size_t leaves = evaluate(a, 6, peak);
+    assert(leaves == 64);
+    assert(peak == 7 * (64 + rz));
+    assert(a.used() == 0);
+  }
+
+  static void test_null_and_out_of_order()
+  {
+    arena::Arena a(1024);
+    a.deallocate(nullptr, 16);
+
+    void *p = a.allocate(16, 16);
+    (void)a.allocate(16, 16);
+
+    // try_deallocate() never asserts: p is not on top, nothing changes.
+    assert(!a.try_deallocate(p, 16));
+    assert(a.used() == 32 + 2 * rz);
+
+    // A wrong size is not a match either.
+    void *r = a.allocate(16, 16);
+    assert(!a.try_deallocate(r, 8));
+    const bool freed = a.try_deallocate(r, 16);
+    assert(freed);
+    assert(a.used() == 32 + 2 * rz);
+  }
+
+  struct Tracked
+  {
+    static inline int destroyed = 0;
+    int value = 7;
+    ~Tracked()
+    {
+      assert(value == 7);
+      ++destroyed;
+    }
+  };
+
+  static void test_tracked_objects_are_not_reclaimed()
+  {
+    Tracked::destroyed = 0;
+    arena::Arena a(4096, arena::Options{.track_destructors = true});
+
+    Tracked *t = a.make<Tracked>();
+    const std::size_t used = a.used();
+    assert(!a.try_deallocate(t, sizeof(Tracked)));
+    assert(a.used() == used);
+
+    // The bytes stay with the object: the next allocation lands after it.
+    auto *n = a.make<int>(12345);
+    assert(reinterpret_cast<std::byte *>(n) >= reinterpret_cast<std::byte *>(t + 1));
+    a.deallocate(n, sizeof(int));
+    assert(a.used() == used);
+
+    a.reset();
+    assert(Tracked::destroyed == 1);
+  }
+
+  static void test_growable_blocks()
+  {
+    arena::Arena a(64, arena::Options{.growth_factor = 2.0});
+    void *big = a.allocate(256, 16);
+    assert(a.block_count() == 2);
+    a.deallocate(big, 256);
+    assert(a.used() == 0);
+  }
+
+  static void test_resource_gives_back_top()
+  {
+    arena::Arena a(4096);
+    arena::Resource res(a);
+    {
+      std::pmr::vector<int> v(&res);
+      v.reserve(16);
+      assert(a.used() == 16 * sizeof(int) + rz);
+    }
+    assert(a.used() == 0);
+  }
+
+  static void test_allocator_gives_back_top()
+  {
+    arena::Arena a(4096);
+    {
+      std::vector<int, arena::Allocator<int>> v{arena::Allocator<int>(a)};
+      v.reserve(8);
+      assert(a.used() == 8 * sizeof(int) + rz);
+    }
+    assert(a.used() == 0);
+  }
+}
+
+int main()
+{
+  test_lifo_frees();
+  test_recursive_peak();
+  test_null_and_out_of_order();
+  test_tracked_objects_are_not_reclaimed();
+  test_growable_blocks();
+  test_resource_gives_back_top();
+  test_allocator_gives_back_top();
+  return 0;
+}
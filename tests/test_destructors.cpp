@@ -0,0 +1,160 @@
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+namespace
+{
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  std::vector<int> g_destroyed;
+
+  struct Tracked
+  {
+    int id;
+    std::string payload;
+
+    explicit Tracked(int i) : id(i), payload("heap-allocated payload string number " + std::to_string(i)) {}
+    ~Tracked() { g_destroyed.push_back(id); }
+  };
+
+  struct Counted
+  {
+    static inline int live = 0;
+    Counted() { ++live; }
+    ~Counted() { --live; }
+  };
+
+  static void test_off_by_default()
+  {
+    g_destroyed.clear();
+    {
+      arena::Arena a(4096);
+      assert(!a.tracks_destructors());
+      Tracked *t = a.make<Tracked>(1);
+      t->~Tracked(); // caller-managed, as before
+      a.reset();
+    }
+    assert(g_destroyed.size() == 1);
+  }
+
+  static void test_reset_runs_lifo()
+  {
+    g_destroyed.clear();
+    arena::Arena a(4096, arena::Options{.track_destructors = true});
+    (void)a.make<Tracked>(1);
+    (void)a.make<Tracked>(2);
+    (void)a.make<Tracked>(3);
+    assert(g_destroyed.empty());
+
+    a.reset();
+    assert((g_destroyed == std::vector<int>{3, 2, 1}));
+    assert(a.used() == 0);
+
+    a.reset();
+    assert(g_destroyed.size() == 3);
+  }
+
+  static void test_rewind_only_back_to_mark()
+  {
+    g_destroyed.clear();
+    arena::Arena a(4096, arena::Options{.track_destructors = true});
+    (void)a.make<Tracked>(1);
+    const auto m = a.mark();
+    (void)a.make<Tracked>(2);
+    (void)a.make<int>(5);
+    (void)a.make<Tracked>(3);
+
+    a.rewind(m);
+    assert((g_destroyed == std::vector<int>{3, 2}));
+
+    {
+      arena::Arena::Scope scope(a);
+      (void)a.make<Tracked>(4);
+    }
+    assert((g_destroyed == std::vector<int>{3, 2, 4}));
+  }
+
+  static void test_arrays_and_destruction()
+  {
+    {
+      arena::Arena a(1 << 16, arena::Options{.track_destructors = true});
+      Counted *c = a.make_array<Counted>(10);
+      assert(c != nullptr);
+      assert(Counted::live == 10);
+      (void)a.make<Counted>();
+      assert(Counted::live == 11);
+    }
+    assert(Counted::live == 0);
+  }
+
+  static void test_trivial_types_cost_nothing()
+  {
+    arena::Arena a(1024, arena::Options{.track_destructors = true});
+    (void)a.make<int>(1);
+    assert(a.used() == sizeof(int) + rz);
+    (void)a.make_array<double>(4);
+    assert(a.used() <= sizeof(int) + 4 + 4 * sizeof(double) + 2 * rz);
+  }
+
+  static void test_shrink_keeps_tracked_objects()
+  {
+    Counted::live = 0;
+    {
+      arena::Arena a(4096, arena::Options{.track_destructors = true});
+
+      Counted *items = a.make_array<Counted>(4);
+      const std::size_t used = a.used();
+
+      // The destructor record still covers all four elements.
+      assert(!a.try_resize(items, 4 * sizeof(Counted), sizeof(Counted)));
+      assert(!a.try_resize(items, 4 * sizeof(Counted), 0));
+      assert(a.used() == used);
+
+      // Growing is harmless.
+      const bool grown = a.try_resize(items, 4 * sizeof(Counted), 8 * sizeof(Counted));
+      assert(grown);
+
+      // Untracked allocations above the last tracked object still shrink.
+      void *raw = a.allocate(64);
+      const bool shrunk = a.try_resize(raw, 64, 16);
+      const bool released = a.try_resize(raw, 16, 0);
+      assert(shrunk && released);
+      assert(Counted::live == 4);
+
+      a.reset();
+      assert(Counted::live == 0);
+    }
+    assert(Counted::live == 0);
+  }
+
+  static void test_across_blocks_and_moves()
+  {
+    g_destroyed.clear();
+    arena::Arena a(128, arena::Options{.growth_factor = 2.0, .track_destructors = true});
+    for (int i = 0; i < 20; ++i)
+      (void)a.make<Tracked>(i);
+    assert(a.block_count() > 1);
+
+    arena::Arena b(std::move(a));
+    a.reset();
+    assert(g_destroyed.empty());
+
+    b = arena::Arena();
+    assert(g_destroyed.size() == 20);
+    assert(g_destroyed.front() == 19 && g_destroyed.back() == 0);
+  }
+}
+
+int main()
+{
+  test_off_by_default();
+  test_reset_runs_lifo();
+  test_rewind_only_back_to_mark();
+  test_arrays_and_destruction();
+  test_trivial_types_cost_nothing();
+  test_shrink_keeps_tracked_objects();
+  test_across_blocks_and_moves();
+  return 0;
+}
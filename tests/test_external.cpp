@@ -0,0 +1,99 @@
+#include <arena/arena.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  static void test_span_buffer()
+  {
+    alignas(16) std::array<std::byte, 256> storage{};
+    arena::Arena a{std::span<std::byte>(storage)};
+    assert(!a.owning());
+    assert(a.capacity() == storage.size());
+
+    void *p = a.allocate(64);
+    assert(p == storage.data());
+    assert(a.owns(p));
+    assert(a.try_allocate(512) == nullptr);
+
+    const auto m = a.mark();
+    (void)a.allocate(64);
+    a.rewind(m);
+    assert(a.used() == 64 + rz);
+  }
+
+  static void test_slice_of_slab()
+  {
+    std::vector<std::byte> slab(4096);
+    arena::Arena left(slab.data(), 2048);
+    arena::Arena right(slab.data() + 2048, 2048);
+
+    void *l = left.allocate(100);
+    void *r = right.allocate(100);
+    assert(left.owns(l) && !left.owns(r));
+    assert(right.owns(r) && !right.owns(l));
+  }
+
+  static void test_external_spills_to_heap()
+  {
+    std::array<std::byte, 64> storage;
+    arena::Arena a(std::span<std::byte>(storage), arena::Options{.growth_factor = 2.0});
+
+    (void)a.allocate(48);
+    void *p = a.allocate(256);
+    assert(a.block_count() == 2);
+    assert(a.owns(p));
+
+    a.reset();
+    assert(a.block_count() == 1);
+  }
+
+  static void test_move_external()
+  {
+    std::array<std::byte, 128> storage;
+    arena::Arena a{std::span<std::byte>(storage)};
+    void *p = a.allocate(8);
+
+    arena::Arena b(std::move(a));
+    assert(!b.owning());
+    assert(b.owns(p));
+    assert(a.owning());
+    assert(a.capacity() == 0);
+  }
+
+  static void test_inline_arena()
+  {
+    arena::InlineArena<512> scratch;
+    assert(scratch->capacity() == 512);
+
+    int *xs = scratch->make_array<int>(16);
+    xs[15] = 3;
+    assert(scratch->owns(xs));
+    assert(reinterpret_cast<std::uintptr_t>(xs) % alignof(int) == 0);
+
+    const std::size_t before = scratch->used();
+    {
+      arena::Arena::Scope scope(scratch);
+      (void)scratch->allocate(100);
+    }
+    assert(scratch->used() == before);
+
+    arena::Arena &a = scratch;
+    assert(&a == &scratch.arena());
+  }
+}
+
+int main()
+{
+  test_span_buffer();
+  test_slice_of_slab();
+  test_external_spills_to_heap();
+  test_move_external();
+  test_inline_arena();
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include <arena/frame_arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+
+namespace
+{
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  static void test_data_lives_n_frames()
+  {
+    arena::FrameArena<3> frames(4096);
+
+    int *f0 = frames->make<int>(0);
+    frames.advance();
+    int *f1 = frames->make<int>(1);
+    frames.advance();
+    int *f2 = frames->make<int>(2);
+
+    // Frames 0..2 are all still alive.
+    assert(*f0 == 0 && *f1 == 1 && *f2 == 2);
+    assert(frames.frame(2).owns(f0));
+    assert(frames.frame(1).owns(f1));
+    assert(frames.frame(0).owns(f2));
+    assert(frames.used() == 3 * (sizeof(int) + rz));
+
+    // Frame 3 reuses frame 0's arena.
+    frames.advance();
+    assert(frames.frame_index() == 3);
+    assert(frames.current().used() == 0);
+    assert(frames.current().owns(f0));
+    assert(frames.frame(2).owns(f1));
+  }
+
+  static void test_double_buffer()
+  {
+    arena::FrameArena<2> frames(1024);
+    auto *produced = frames->make_array<std::uint8_t>(100);
+    frames.advance();
+
+    // The consumer still reads the previous frame while the producer fills
+    // the new one.
+    auto *next = frames->make_array<std::uint8_t>(100);
+    assert(frames.frame(1).owns(produced));
+    assert(frames.frame(0).owns(next));
+    assert(produced != next);
+  }
+
+  static void test_peak_used()
+  {
+    arena::FrameArena<2> frames(1 << 16);
+    (void)frames->allocate(1000, 1);
+    frames.advance();
+    (void)frames->allocate(300, 1);
+    frames.advance();
+    frames.advance();
+
+    assert(frames.peak_used() == 1000 + rz);
+    assert(frames.frame_used(0) == 0);
+
+    (void)frames->allocate(5000, 1);
+    assert(frames.peak_used() == 5000 + rz);
+
+    frames.reset();
+    assert(frames.used() == 0);
+    assert(frames.peak_used() == 5000 + rz);
+  }
+
+  static void test_growable_frames()
+  {
+    arena::FrameArena<2> frames(256, arena::Options{.growth_factor = 2.0});
+    for (int i = 0; i < 100; ++i)
+      (void)frames->allocate(64);
+    assert(frames.current().block_count() > 1);
+    frames.advance();
+    frames.advance();
+    assert(frames.current().used() == 0);
+  }
+}
+
+int main()
+{
+  test_data_lives_n_frames();
+  test_double_buffer();
+  test_peak_used();
+  test_growable_frames();
+  return 0;
+}
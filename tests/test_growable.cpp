@@ -0,0 +1,159 @@
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+  static void test_fixed_by_default()
+  {
+    arena::Arena a(64);
+    assert(!a.growable());
+    assert(a.try_allocate(128) == nullptr);
+    assert(a.block_count() == 1);
+  }
+
+  static void test_grows_past_initial_buffer()
+  {
+    arena::Arena a(64, arena::Options{.growth_factor = 2.0, .min_block_size = 128});
+    assert(a.growable());
+
+    void *p1 = a.allocate(48, 8);
+    void *p2 = a.allocate(48, 8);
+    assert(a.block_count() == 2);
+    assert(a.owns(p1));
+    assert(a.owns(p2));
+    assert(a.capacity() >= 64 + 128);
+    assert(a.used() >= 96);
+
+    // Larger than any computed block size: gets a dedicated block.
+    auto *big = static_cast<std::uint8_t *>(a.allocate(10000, 64));
+    assert((reinterpret_cast<std::uintptr_t>(big) % 64) == 0);
+    std::memset(big, 0xAB, 10000);
+    assert(a.owns(big));
+    assert(a.owns(big + 9999));
+    assert(a.block_count() == 3);
+  }
+
+  static void test_rewind_across_blocks()
+  {
+    arena::Arena a(64, arena::Options{.growth_factor = 2.0, .min_block_size = 128});
+
+    (void)a.allocate(32);
+    const auto m = a.mark();
+    const std::size_t used = a.used();
+
+    for (int i = 0; i < 20; ++i)
+      (void)a.allocate(64);
+    assert(a.block_count() > 1);
+
+    a.rewind(m);
+    assert(a.used() == used);
+    assert(a.block_count() == 1);
+
+    // A mark inside a chained block.
+    for (int i = 0; i < 4; ++i)
+      (void)a.allocate(64);
+    const auto inner = a.mark();
+    const std::size_t inner_used = a.used();
+    const std::size_t inner_blocks = a.block_count();
+    assert(inner_blocks > 1);
+
+    for (int i = 0; i < 20; ++i)
+      (void)a.allocate(64);
+
+    a.rewind(inner);
+    assert(a.used() == inner_used);
+    assert(a.block_count() == inner_blocks);
+  }
+
+  static void test_scope_across_blocks()
+  {
+    arena::Arena a(64, arena::Options{.growth_factor = 1.5});
+
+    (void)a.allocate(16);
+    const std::size_t before = a.used();
+    {
+      arena::Arena::Scope scope(a);
+      int *arr = a.make_array<int>(4096);
+      arr[4095] = 1;
+      assert(a.block_count() == 2);
+    }
+    assert(a.used() == before);
+    assert(a.block_count() == 1);
+  }
+
+  static void test_reset_reuses_cached_blocks()
+  {
+    arena::Arena a(64, arena::Options{.growth_factor = 2.0, .min_block_size = 256});
+
+    for (int i = 0; i < 16; ++i)
+      (void)a.allocate(64);
+    const std::size_t blocks = a.block_count();
+
+    a.reset();
+    assert(a.used() == 0);
+    assert(a.block_count() == 1);
+    assert(a.capacity() == 64);
+
+    (void)a.allocate(64);
+    void *first_chained = a.allocate(64);
+    a.reset();
+
+    // The same cached block is handed out again.
+    (void)a.allocate(64);
+    assert(a.allocate(64) == first_chained);
+
+    for (int i = 0; i < 14; ++i)
+      (void)a.allocate(64);
+    assert(a.block_count() == blocks);
+
+    a.reset();
+    a.trim();
+    assert(a.block_count() == 1);
+  }
+
+  static void test_no_cache_keeps_largest()
+  {
+    arena::Arena a(0, arena::Options{.growth_factor = 2.0, .min_block_size = 256, .cache_blocks = false});
+
+    void *p = a.allocate(100000);
+    (void)a.allocate(1 << 20);
+    void *big = a.allocate(1 << 22);
+    a.reset();
+
+    // Only the largest block survives reset() and is reused first.
+    assert(a.allocate(100000) == big);
+    (void)p;
+  }
+
+  static void test_move_transfers_blocks()
+  {
+    arena::Arena a(32, arena::Options{.growth_factor = 2.0});
+    void *p = a.allocate(1024);
+
+    arena::Arena b(std::move(a));
+    assert(b.owns(p));
+    assert(!a.owns(p));
+    assert(a.used() == 0);
+    assert(b.block_count() == 2);
+
+    arena::Arena c;
+    c = std::move(b);
+    assert(c.owns(p));
+    assert(b.block_count() == 1);
+  }
+}
+
+int main()
+{
+  test_fixed_by_default();
+  test_grows_past_initial_buffer();
+  test_rewind_across_blocks();
+  test_scope_across_blocks();
+  test_reset_reuses_cached_blocks();
+  test_no_cache_keeps_largest();
+  test_move_transfers_blocks();
+  return 0;
+}
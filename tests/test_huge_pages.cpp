@@ -0,0 +1,81 @@
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+  constexpr std::size_t MiB = 1024 * 1024;
+
+  static bool is_power_of_two(std::size_t x)
+  {
+    return x != 0 && (x & (x - 1)) == 0;
+  }
+
+  static void check_buffer(arena::Arena &a, std::size_t requested)
+  {
+    assert(is_power_of_two(a.page_size()));
+    assert(a.capacity() >= requested);
+    assert(a.capacity() % a.page_size() == 0);
+    assert(a.remaining() == a.capacity());
+
+    auto *p = static_cast<std::uint8_t *>(a.allocate(requested, 64));
+    std::memset(p, 0x11, requested);
+    assert(a.owns(p));
+    assert(a.owns(p + requested - 1));
+  }
+
+  static void test_transparent()
+  {
+    arena::Arena a(3 * MiB, arena::Options{.huge_pages = arena::HugePages::transparent});
+    assert(a.huge_pages() == arena::HugePages::transparent || a.huge_pages() == arena::HugePages::none);
+    if (a.huge_pages() == arena::HugePages::transparent)
+    {
+      assert(a.page_size() == 2 * MiB);
+      assert(a.capacity() == 4 * MiB);
+    }
+    check_buffer(a, 3 * MiB);
+  }
+
+  static void test_explicit_falls_back()
+  {
+    // Succeeds whether or not a hugetlb pool is configured.
+    arena::Arena a(3 * MiB, arena::Options{.huge_pages = arena::HugePages::size_2mb});
+    assert(a.huge_pages() != arena::HugePages::size_1gb);
+    assert(a.committed() == a.capacity());
+    assert(!a.reserved());
+    check_buffer(a, 3 * MiB);
+
+    arena::Arena g(1 * MiB, arena::Options{.huge_pages = arena::HugePages::size_1gb});
+    check_buffer(g, 1 * MiB);
+  }
+
+  static void test_reserved_transparent()
+  {
+    arena::Arena a(0, arena::Options{.reserve_bytes = 64 * MiB, .huge_pages = arena::HugePages::size_2mb});
+    assert(a.reserved());
+    assert(a.huge_pages() == arena::HugePages::transparent || a.huge_pages() == arena::HugePages::none);
+
+    auto *p = static_cast<std::uint8_t *>(a.allocate(5 * MiB));
+    p[5 * MiB - 1] = 1;
+    assert(a.committed() % a.page_size() == 0);
+  }
+
+  static void test_heap_page_size()
+  {
+    arena::Arena a(1000);
+    assert(a.huge_pages() == arena::HugePages::none);
+    assert(is_power_of_two(a.page_size()));
+    assert(a.capacity() == 1000);
+  }
+}
+
+int main()
+{
+  test_transparent();
+  test_explicit_falls_back();
+  test_reserved_transparent();
+  test_heap_page_size();
+  return 0;
+}
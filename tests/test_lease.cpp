@@ -0,0 +1,143 @@
+#include <arena/lease.hpp>
+#include <arena/vector.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  static void test_bumps_inside_lease()
+  {
+    arena::ConcurrentArena shared(1 << 20);
+    arena::Lease lease(shared, 4096);
+
+    assert(lease.stats().leases == 0);
+    int *first = lease->make<int>(1);
+    assert(shared.owns(first));
+    assert(lease.stats().leases == 1);
+
+    const std::size_t shared_used = shared.used();
+    for (int i = 0; i < 100; ++i)
+      (void)lease->make<int>(i);
+    // No further traffic on the shared arena while the sub-chunk has room.
+    assert(shared.used() == shared_used);
+    assert(lease.stats().leases == 1);
+    assert(lease.stats().leased_bytes == 4096);
+  }
+
+  static void test_wasted_tail()
+  {
+    arena::ConcurrentArena shared(1 << 20);
+    arena::Lease lease(shared, 4096);
+
+    const std::size_t usable = 4096 - arena::Arena::block_overhead();
+    constexpr std::size_t rz = arena::Arena::redzone_size;
+    (void)lease->allocate(usable - 100 - rz, 16);
+    (void)lease->allocate(200, 16); // does not fit: moves to a new sub-chunk
+
+    arena::LeaseStats s = lease.stats();
+    assert(s.leases == 2);
+    assert(s.wasted_bytes == 100);
+    assert(s.remaining_bytes == usable - 200 - rz);
+
+    arena::LeaseStats total;
+    total += s;
+    total += s;
+    assert(total.wasted_bytes == 200);
+  }
+
+  static void test_large_allocation_gets_own_chunk()
+  {
+    arena::ConcurrentArena shared(1 << 20);
+    arena::Lease lease(shared, 4096);
+    void *p = lease->allocate(10000);
+    assert(shared.owns(p));
+    assert(lease.stats().leased_bytes >= 10000);
+  }
+
+  static void test_large_allocation_does_not_inflate_refills()
+  {
+    arena::ConcurrentArena shared(1 << 20);
+    arena::Lease lease(shared, 4096);
+    (void)lease->allocate(100000);
+
+    // The next refill is sized for the request, not for the previous chunk.
+    std::size_t before = lease.stats().leased_bytes;
+    (void)lease->allocate(8000);
+    assert(lease.stats().leased_bytes - before < 8000 + 1024);
+
+    // Small requests are back to lease_size sub-chunks.
+    before = lease.stats().leased_bytes;
+    const std::size_t shared_before = shared.used();
+    (void)lease->allocate(100);
+    assert(lease.stats().leased_bytes - before == 4096);
+    assert(shared.used() - shared_before < 2 * 4096);
+  }
+
+  static void test_lease_is_an_arena()
+  {
+    arena::ConcurrentArena shared(1 << 20);
+    arena::Lease lease(shared);
+    arena::Vector<std::uint32_t> v(lease);
+    for (std::uint32_t i = 0; i < 1000; ++i)
+      v.push_back(i);
+    assert(v.back() == 999);
+
+    const std::size_t leases = lease.stats().leases;
+    lease->reset(); // sub-chunks stay with the lease
+    (void)lease->allocate(64);
+    assert(lease.stats().leases == leases);
+  }
+
+  static void test_many_threads_one_reset()
+  {
+    arena::ConcurrentArena shared(1 << 16, arena::Options{.growth_factor = 2.0});
+    constexpr int kThreads = 8;
+    constexpr int kPerThread = 5000;
+
+    std::vector<std::vector<std::uint64_t *>> results(kThreads);
+    std::vector<arena::LeaseStats> stats(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+      threads.emplace_back([&, t]
+                           {
+        arena::Lease lease(shared, 8192);
+        for (int i = 0; i < kPerThread; ++i)
+          results[static_cast<std::size_t>(t)].push_back(lease->make<std::uint64_t>(static_cast<std::uint64_t>(t) << 32 | static_cast<std::uint64_t>(i)));
+        stats[static_cast<std::size_t>(t)] = lease.stats(); });
+    }
+    for (auto &th : threads)
+      th.join();
+
+    arena::LeaseStats total;
+    for (int t = 0; t < kThreads; ++t)
+    {
+      total += stats[static_cast<std::size_t>(t)];
+      for (int i = 0; i < kPerThread; ++i)
+      {
+        const std::uint64_t *p = results[static_cast<std::size_t>(t)][static_cast<std::size_t>(i)];
+        assert(shared.owns(p));
+        assert(*p == (static_cast<std::uint64_t>(t) << 32 | static_cast<std::uint64_t>(i)));
+      }
+    }
+    assert(total.leases >= kThreads);
+    assert(shared.used() >= total.leased_bytes);
+
+    shared.reset();
+    assert(shared.used() == 0);
+  }
+}
+
+int main()
+{
+  test_bumps_inside_lease();
+  test_wasted_tail();
+  test_large_allocation_gets_own_chunk();
+  test_large_allocation_does_not_inflate_refills();
+  test_lease_is_an_arena();
+  test_many_threads_one_reset();
+  return 0;
+}
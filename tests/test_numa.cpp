@@ -0,0 +1,100 @@
+#include <arena/numa.hpp>
+#include <arena/thread_scratch.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+  static void test_local_node()
+  {
+    arena::Arena a(1 << 20, arena::Options{.numa_node = arena::Options::local_numa_node});
+    // Mapped for mbind, but committed in full: not a reservation.
+    assert(!a.reserved());
+    assert(a.committed() == a.capacity());
+
+    const int node = arena::detail::vm::current_numa_node();
+#if defined(__linux__)
+    // Binding to a node we run on only fails where mbind is unavailable.
+    assert(a.numa_node() == -1 || a.numa_node() == node);
+#endif
+    (void)node;
+
+    auto *p = static_cast<char *>(a.allocate(4096));
+    std::memset(p, 1, 4096);
+    assert(a.owns(p));
+  }
+
+  static void test_explicit_node_and_fallback()
+  {
+    arena::Arena a(64 * 1024, arena::Options{.numa_node = 0});
+    void *p = a.allocate(100);
+    assert(a.owns(p));
+
+    // A node that does not exist leaves the buffer unbound but usable.
+    arena::Arena b(64 * 1024, arena::Options{.prefault = true, .numa_node = arena::max_numa_nodes - 1});
+    assert(b.numa_node() == -1 || b.numa_node() == arena::max_numa_nodes - 1);
+    assert(b.allocate(100) != nullptr);
+
+    arena::Arena c(0, arena::Options{.numa_node = 0});
+    assert(c.capacity() == 0 && c.numa_node() == -1);
+
+    arena::Arena moved(std::move(a));
+    assert(a.numa_node() == -1);
+    assert(moved.owns(p));
+  }
+
+  static void test_numa_resource()
+  {
+    arena::NumaResource res(0);
+    void *p = res.allocate(10000, 64);
+    assert((reinterpret_cast<std::uintptr_t>(p) % 64) == 0);
+    std::memset(p, 0, 10000);
+    res.deallocate(p, 10000, 64);
+
+    arena::NumaResource other(0);
+    assert(res.is_equal(other));
+    assert(!res.is_equal(*std::pmr::new_delete_resource()));
+  }
+
+  static void test_node_pools()
+  {
+    arena::BlockPool &p0 = arena::node_block_pool(0);
+    assert(&p0 == &arena::node_block_pool(0));
+    assert(&p0 != &arena::BlockPool::global());
+    assert(&arena::node_block_pool(-1) == &arena::BlockPool::global());
+
+    void *b = p0.allocate(p0.block_size(), arena::BlockPool::block_alignment);
+    p0.deallocate(b, p0.block_size(), arena::BlockPool::block_alignment);
+    assert(p0.free_blocks() >= 1);
+  }
+
+  static void test_numa_thread_scratch()
+  {
+    std::thread t([]
+                  {
+      arena::Arena &s = arena::numa_thread_scratch();
+      assert(&s == &arena::numa_thread_scratch());
+      assert(&s != &arena::thread_scratch());
+      {
+        arena::Arena::Scope scope(s);
+        auto *p = s.make_array<std::uint64_t>(1000);
+        p[999] = 1;
+        assert(s.owns(p));
+      }
+      assert(s.used() == 0); });
+    t.join();
+  }
+}
+
+int main()
+{
+  test_local_node();
+  test_explicit_node_and_fallback();
+  test_numa_resource();
+  test_node_pools();
+  test_numa_thread_scratch();
+  return 0;
+}
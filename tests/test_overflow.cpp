@@ -0,0 +1,205 @@
+#include <arena/arena.hpp>
+#include <arena/resource.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+static_assert(arena::Arena::stats_enabled, "test_overflow must be built with ARENA_ENABLE_STATS=1");
+
+namespace
+{
+  // Counts what is outstanding so the tests can see overflow blocks go back.
+  class CountingResource final : public std::pmr::memory_resource
+  {
+  public:
+    std::size_t requests = 0;
+    std::size_t live = 0;
+    std::size_t bytes = 0;
+    bool fail = false;
+
+  private:
+    void *do_allocate(std::size_t n, std::size_t alignment) override
+    {
+      ++requests;
+      if (fail)
+        throw std::bad_alloc{};
+      void *p = std::pmr::new_delete_resource()->allocate(n, alignment);
+      ++live;
+      bytes += n;
+      return p;
+    }
+
+    void do_deallocate(void *p, std::size_t n, std::size_t alignment) override
+    {
+      --live;
+      bytes -= n;
+      std::pmr::new_delete_resource()->deallocate(p, n, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+  };
+
+  static void test_oversize_goes_to_overflow()
+  {
+    CountingResource upstream;
+    arena::Arena a(256, arena::Options{.overflow = &upstream});
+
+    void *small = a.allocate(64);
+    assert(a.owns(small) && upstream.live == 0);
+
+    void *big = a.allocate(1000, 64);
+    assert(big != nullptr);
+    assert(reinterpret_cast<std::uintptr_t>(big) % 64 == 0);
+    std::memset(big, 0xcd, 1000);
+    assert(upstream.live == 1);
+    assert(a.owns(big));
+    assert(a.overflow_bytes() == 1000);
+
+    // The bump path is still used while the buffer has room.
+    void *next = a.allocate(64);
+    assert(next == static_cast<std::byte *>(small) + 64 + arena::Arena::redzone_size);
+
+    const arena::Stats s = a.stats();
+    assert(s.overflows == 1);
+    assert(s.allocations == 3);
+    assert(s.failed_allocations == 0);
+
+    a.reset();
+    assert(upstream.live == 0 && upstream.bytes == 0);
+    assert(a.overflow_bytes() == 0);
+    assert(!a.owns(big));
+  }
+
+  static void test_rewind_frees_overflow_after_mark()
+  {
+    CountingResource upstream;
+    arena::Arena a(128, arena::Options{.overflow = &upstream});
+
+    (void)a.allocate(512);
+    const arena::Arena::Mark m = a.mark();
+    (void)a.allocate(512);
+    (void)a.allocate(512);
+    assert(upstream.live == 3);
+
+    a.rewind(m);
+    assert(upstream.live == 1);
+
+    {
+      arena::Arena::Scope scope(a);
+      (void)a.allocate(2048);
+      assert(upstream.live == 2);
+    }
+    assert(upstream.live == 1);
+    assert(a.overflow_bytes() == 512);
+  }
+
+  static void test_deallocate_returns_last_overflow()
+  {
+    CountingResource upstream;
+    arena::Arena a(64, arena::Options{.overflow = &upstream});
+
+    void *p = a.allocate(100);
+    void *q = a.allocate(200);
+    assert(upstream.live == 2);
+
+    assert(!a.try_deallocate(p, 100)); // not the most recent
+    assert(a.try_deallocate(q, 200));
+    assert(upstream.live == 1);
+    assert(a.try_deallocate(p, 100));
+    assert(upstream.live == 0);
+
+    // A mark taken before an eagerly freed overflow still rewinds correctly.
+    const arena::Arena::Mark m = a.mark();
+    void *r = a.allocate(100);
+    a.deallocate(r, 100);
+    (void)a.allocate(300);
+    assert(upstream.live == 1);
+    a.rewind(m);
+    assert(upstream.live == 0);
+  }
+
+  static void test_overflow_failure_and_destructor()
+  {
+    CountingResource upstream;
+    {
+      arena::Arena a(64, arena::Options{.overflow = &upstream});
+      upstream.fail = true;
+      assert(a.try_allocate(1000) == nullptr);
+      assert(a.stats().failed_allocations == 1);
+
+      upstream.fail = false;
+      (void)a.make_array<std::uint64_t>(100);
+      assert(upstream.live == 1);
+
+      arena::Arena b(std::move(a));
+      assert(b.overflow_bytes() == 100 * sizeof(std::uint64_t));
+      assert(a.overflow_bytes() == 0);
+    }
+    assert(upstream.live == 0);
+  }
+
+  static void test_huge_sizes_do_not_wrap()
+  {
+    CountingResource upstream;
+    arena::Arena a(256, arena::Options{.overflow = &upstream});
+    (void)a.allocate(64);
+    const std::size_t used = a.used();
+
+    // offset + size would wrap around: must not land inside the buffer.
+    assert(a.try_allocate(SIZE_MAX - 8) == nullptr);
+    assert(a.try_allocate<8>(SIZE_MAX - 8) == nullptr);
+    assert(a.used() == used);
+    assert(a.stats().failed_allocations == 2);
+
+    // Oversize but representable: goes to the resource.
+    upstream.fail = true;
+    assert(a.try_allocate(SIZE_MAX / 2) == nullptr);
+    assert(upstream.requests == 1);
+    assert(a.used() == used);
+
+    arena::Arena plain(256);
+    (void)plain.allocate(64);
+    assert(plain.try_allocate(SIZE_MAX - 8) == nullptr);
+    assert(plain.try_allocate<1>(SIZE_MAX) == nullptr);
+    assert(plain.used() == used);
+  }
+
+  static void test_arena_as_overflow()
+  {
+    arena::Arena spill(1 << 16);
+    arena::Resource spill_resource(spill);
+    arena::Arena a(256, arena::Options{.overflow = &spill_resource});
+
+    void *p = a.allocate(4096);
+    assert(spill.owns(p));
+
+    // No overflow: allocate() still throws.
+    arena::Arena fixed(64);
+    bool thrown = false;
+    try
+    {
+      (void)fixed.allocate(1000);
+    }
+    catch (const std::bad_alloc &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+}
+
+int main()
+{
+  test_oversize_goes_to_overflow();
+  test_rewind_frees_overflow_after_mark();
+  test_deallocate_returns_last_overflow();
+  test_overflow_failure_and_destructor();
+  test_huge_sizes_do_not_wrap();
+  test_arena_as_overflow();
+  return 0;
+}
@@ -0,0 +1,137 @@
+// The checks are asserts: keep them in Release builds too.
+#undef NDEBUG
+
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+
+#if defined(__SANITIZE_ADDRESS__)
+#include <sanitizer/asan_interface.h>
+#define ARENA_TEST_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#include <sanitizer/asan_interface.h>
+#define ARENA_TEST_ASAN 1
+#endif
+#endif
+
+static_assert(arena::Arena::poisoning_enabled, "test_poisoning must be built with ARENA_ENABLE_POISONING=1");
+
+namespace
+{
+  // CMake builds this test with ASan. Elsewhere only the bookkeeping
+  // (redzones, offsets) can be checked and the poison queries are skipped.
+  static bool poisoned([[maybe_unused]] const void *p)
+  {
+#if defined(ARENA_TEST_ASAN)
+    return __asan_address_is_poisoned(p) != 0;
+#else
+    return true;
+#endif
+  }
+
+  static bool accessible([[maybe_unused]] const void *p, [[maybe_unused]] std::size_t n)
+  {
+#if defined(ARENA_TEST_ASAN)
+    return __asan_region_is_poisoned(const_cast<void *>(p), n) == nullptr;
+#else
+    return true;
+#endif
+  }
+
+  static void test_redzones()
+  {
+    arena::Arena a(4096);
+    auto *p = static_cast<char *>(a.allocate(24, 8));
+    auto *q = static_cast<char *>(a.allocate(24, 8));
+
+    assert(arena::Arena::redzone_size > 0);
+    assert(q >= p + 24 + arena::Arena::redzone_size);
+    assert(accessible(p, 24));
+    assert(accessible(q, 24));
+    assert(poisoned(p + 24));
+    assert(poisoned(q + 24));
+  }
+
+  static void test_free_space_is_poisoned()
+  {
+    arena::Arena a(4096);
+    auto *p = static_cast<char *>(a.allocate(64, 16));
+    assert(poisoned(p + 1024));
+    assert(poisoned(p + 4000));
+  }
+
+  static void test_rewind_and_reset_poison()
+  {
+    arena::Arena a(4096);
+    const arena::Arena::Mark m = a.mark();
+    auto *p = static_cast<char *>(a.allocate(64, 16));
+    p[0] = 1;
+    a.rewind(m);
+    assert(poisoned(p));
+
+    auto *q = static_cast<char *>(a.allocate(64, 16));
+    assert(q == p);
+    assert(accessible(q, 64));
+    q[63] = 2;
+
+    a.reset();
+    assert(poisoned(q));
+    assert(poisoned(q + 63));
+  }
+
+  static void test_resize()
+  {
+    arena::Arena a(4096);
+    auto *p = static_cast<char *>(a.allocate(16, 1));
+    const bool grown = a.try_resize(p, 16, 256);
+    assert(grown);
+    assert(accessible(p, 256));
+    assert(poisoned(p + 256));
+
+    const bool shrunk = a.try_resize(p, 256, 8);
+    assert(shrunk);
+    assert(poisoned(p + 8));
+
+    const bool released = a.try_resize(p, 8, 0);
+    assert(released);
+    assert(a.used() == 0);
+    assert(poisoned(p));
+  }
+
+  static void test_growable_blocks()
+  {
+    arena::Arena a(256, arena::Options{.growth_factor = 2.0, .min_block_size = 256});
+    const arena::Arena::Mark m = a.mark();
+
+    char *last = nullptr;
+    for (int i = 0; i < 64; ++i)
+    {
+      last = static_cast<char *>(a.allocate(48, 8));
+      last[47] = 1;
+    }
+    assert(a.block_count() > 1);
+
+    a.rewind(m);
+    assert(poisoned(last));
+
+    a.trim(); // cached blocks are unpoisoned before they are freed
+    for (int i = 0; i < 64; ++i)
+      (void)a.allocate(48, 8);
+  }
+}
+
+int main()
+{
+#if !defined(ARENA_TEST_ASAN)
+  std::fputs("test_poisoning: built without ASan, poison checks skipped\n", stderr);
+#endif
+  test_redzones();
+  test_free_space_is_poisoned();
+  test_rewind_and_reset_poison();
+  test_resize();
+  test_growable_blocks();
+  return 0;
+}
@@ -0,0 +1,125 @@
+#include <arena/pool.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  struct Timer
+  {
+    std::uint64_t deadline;
+    std::string name;
+
+    Timer(std::uint64_t d, std::string n) : deadline(d), name(std::move(n)) {}
+  };
+
+  static void test_create_destroy_reuses_slots()
+  {
+    arena::Arena a(1 << 16);
+    arena::Pool<Timer> pool(a, 8);
+
+    Timer *t1 = pool.create(10, "t1");
+    Timer *t2 = pool.create(20, "t2");
+    assert(pool.live() == 2);
+    assert(pool.owns(t1) && pool.owns(t2));
+    assert(t2->deadline == 20 && t2->name == "t2");
+
+    const std::size_t used = a.used();
+    pool.destroy(t1);
+    assert(pool.live() == 1);
+    assert(pool.free_slots() == 1);
+
+    Timer *t3 = pool.create(30, "t3");
+    assert(t3 == t1);
+    assert(pool.free_slots() == 0);
+    assert(a.used() == used);
+
+    pool.destroy(t2);
+    pool.destroy(t3);
+    pool.destroy(nullptr);
+    assert(pool.live() == 0);
+  }
+
+  static void test_chunks_and_owns()
+  {
+    arena::Arena a(1 << 16);
+    arena::Pool<int> pool(a, 4);
+
+    std::vector<int *> xs;
+    for (int i = 0; i < 10; ++i)
+      xs.push_back(pool.create(i));
+
+    assert(pool.chunk_count() == 3);
+    assert(pool.capacity() == 12);
+    for (int i = 0; i < 10; ++i)
+      assert(*xs[static_cast<std::size_t>(i)] == i);
+
+    int *outside = a.make<int>(0);
+    assert(a.owns(outside));
+    assert(!pool.owns(outside));
+  }
+
+  static void test_cache_line_slots()
+  {
+    arena::Arena a(1 << 16);
+    arena::Pool<std::uint32_t, arena::cache_line_size> pool(a);
+
+    assert(pool.slot_size() == arena::cache_line_size);
+    auto *p = pool.create(1u);
+    auto *q = pool.create(2u);
+    assert((reinterpret_cast<std::uintptr_t>(p) % arena::cache_line_size) == 0);
+    assert((reinterpret_cast<std::uintptr_t>(q) % arena::cache_line_size) == 0);
+    assert(reinterpret_cast<std::uintptr_t>(q) - reinterpret_cast<std::uintptr_t>(p) == arena::cache_line_size);
+  }
+
+  static void test_exhaustion_and_throwing_ctor()
+  {
+    struct Picky
+    {
+      explicit Picky(int v)
+      {
+        if (v < 0)
+          throw std::invalid_argument("negative");
+      }
+    };
+
+    arena::Arena a(256);
+    arena::Pool<Picky> pool(a, 4);
+
+    bool threw = false;
+    try
+    {
+      (void)pool.create(-1);
+    }
+    catch (const std::invalid_argument &)
+    {
+      threw = true;
+    }
+    assert(threw);
+    assert(pool.live() == 0 && pool.free_slots() == 1);
+
+    arena::Pool<std::uint64_t> big(a, 1000);
+    threw = false;
+    try
+    {
+      (void)big.create(1u);
+    }
+    catch (const std::bad_alloc &)
+    {
+      threw = true;
+    }
+    assert(threw);
+  }
+}
+
+int main()
+{
+  test_create_destroy_reuses_slots();
+  test_chunks_and_owns();
+  test_cache_line_slots();
+  test_exhaustion_and_throwing_ctor();
+  return 0;
+}
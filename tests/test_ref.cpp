@@ -0,0 +1,129 @@
+#include <arena/ref.hpp>
+#include <arena/rel_ptr.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+  struct Node
+  {
+    std::uint32_t key = 0;
+    arena::Ref<Node> left;
+    arena::Ref<Node> right;
+  };
+
+  static_assert(sizeof(arena::Ref<Node>) == 4);
+  static_assert(sizeof(Node) == 12);
+  static_assert(sizeof(arena::RelPtr<Node, std::int32_t>) == 4);
+
+  static Node *insert(arena::Arena &a, Node *root, std::uint32_t key)
+  {
+    Node *n = a.make<Node>();
+    n->key = key;
+    if (!root)
+      return n;
+
+    Node *cur = root;
+    for (;;)
+    {
+      arena::Ref<Node> &next = key < cur->key ? cur->left : cur->right;
+      if (!next)
+      {
+        next = arena::Ref<Node>::to(a, n);
+        return root;
+      }
+      cur = next.get(a);
+    }
+  }
+
+  static bool contains(const arena::Arena &a, const Node *n, std::uint32_t key)
+  {
+    while (n)
+    {
+      if (n->key == key)
+        return true;
+      n = (key < n->key ? n->left : n->right).get(a);
+    }
+    return false;
+  }
+
+  static void test_null()
+  {
+    arena::Arena a(256);
+    arena::Ref<Node> r;
+    assert(!r && r == nullptr);
+    assert(r.get(a) == nullptr);
+    assert(arena::Ref<Node>::to(a, nullptr) == nullptr);
+  }
+
+  static void test_first_allocation()
+  {
+    // Offset 0 is a valid object, distinct from null.
+    arena::Arena a(256);
+    Node *n = a.make<Node>();
+    auto r = arena::Ref<Node>::to(a, n);
+    assert(r && r.offset() == 0);
+    assert(r.get(a) == n);
+  }
+
+  static void test_tree()
+  {
+    arena::Arena a(64 * 1024);
+    Node *root = nullptr;
+    for (std::uint32_t k : {50u, 20u, 80u, 10u, 30u, 70u, 90u})
+      root = insert(a, root, k);
+
+    for (std::uint32_t k : {50u, 20u, 80u, 10u, 30u, 70u, 90u})
+      assert(contains(a, root, k));
+    assert(!contains(a, root, 55));
+  }
+
+  static void test_relocated_buffer()
+  {
+    // Offsets survive a byte-wise copy of the buffer.
+    arena::Arena a(1024);
+    Node *root = nullptr;
+    for (std::uint32_t k : {2u, 1u, 3u})
+      root = insert(a, root, k);
+
+    // Poisoning builds poison the redzones between nodes; a raw copy has
+    // to unpoison them first, as save_snapshot() does.
+    arena::detail::unpoison_region(a.buffer().data(), a.used());
+    std::byte copy[1024];
+    std::memcpy(copy, a.buffer().data(), a.used());
+
+    const auto *moved = reinterpret_cast<const Node *>(copy + (reinterpret_cast<std::byte *>(root) - a.buffer().data()));
+    const std::byte *base = copy;
+    assert(moved->key == 2);
+    assert(moved->left.get(base)->key == 1);
+    assert(moved->right.get(base)->key == 3);
+  }
+
+  static void test_narrow_rel_ptr()
+  {
+    struct Link
+    {
+      int value;
+      arena::RelPtr<Link, std::int32_t> next;
+    };
+
+    arena::Arena a(1024);
+    Link *first = a.make<Link>(Link{1, nullptr});
+    Link *second = a.make<Link>(Link{2, nullptr});
+    first->next = second;
+    assert(first->next->value == 2);
+    assert(first->next.offset() > 0);
+  }
+}
+
+int main()
+{
+  test_null();
+  test_first_allocation();
+  test_tree();
+  test_relocated_buffer();
+  test_narrow_rel_ptr();
+  return 0;
+}
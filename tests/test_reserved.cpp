@@ -0,0 +1,128 @@
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+  constexpr std::size_t KiB = 1024;
+  constexpr std::size_t MiB = 1024 * KiB;
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  static void test_reserve_commits_lazily()
+  {
+    arena::Arena a(0, arena::Options{.reserve_bytes = 1024 * MiB});
+    assert(a.reserved());
+    assert(a.capacity() >= 1024 * MiB);
+    assert(a.committed() == 0);
+    assert(a.remaining() == a.capacity());
+
+    auto *p = static_cast<std::uint8_t *>(a.allocate(100));
+    p[99] = 1;
+    assert(a.committed() >= 64 * KiB);
+    assert(a.committed() < 1024 * MiB);
+
+    // Pointers never move while the committed range grows.
+    auto *q = static_cast<std::uint8_t *>(a.allocate(3 * MiB));
+    std::memset(q, 0x5A, 3 * MiB);
+    assert(p[99] == 1);
+    assert(a.owns(p));
+    assert(a.owns(q + 3 * MiB - 1));
+    assert(a.committed() >= a.used());
+    assert(a.block_count() == 1);
+  }
+
+  static void test_initial_commit_and_limit()
+  {
+    arena::Arena a(100 * KiB, arena::Options{.reserve_bytes = 1 * MiB});
+    assert(a.committed() >= 100 * KiB);
+    assert(a.try_allocate(2 * MiB) == nullptr);
+
+    void *p = a.allocate(a.remaining() - rz, 1);
+    assert(p != nullptr);
+    assert(a.committed() == a.capacity());
+    assert(a.try_allocate(1) == nullptr);
+  }
+
+  static void test_decommit_threshold()
+  {
+    arena::Arena a(0, arena::Options{.reserve_bytes = 256 * MiB, .decommit_threshold = 1 * MiB});
+
+    (void)a.allocate(4 * KiB);
+    const auto m = a.mark();
+    auto *big = static_cast<std::uint8_t *>(a.allocate(16 * MiB));
+    big[16 * MiB - 1] = 1;
+    assert(a.committed() >= 16 * MiB);
+
+    a.rewind(m);
+    assert(a.committed() <= 1 * MiB);
+
+    // Decommitted pages are committed again on demand.
+    big = static_cast<std::uint8_t *>(a.allocate(8 * MiB));
+    big[8 * MiB - 1] = 2;
+
+    a.reset();
+    assert(a.used() == 0);
+    assert(a.committed() <= 1 * MiB);
+  }
+
+  static void test_reserved_then_chained()
+  {
+    arena::Arena a(0, arena::Options{.growth_factor = 1.0, .reserve_bytes = 64 * KiB});
+
+    (void)a.allocate(60 * KiB);
+    void *p = a.allocate(16 * KiB);
+    assert(a.block_count() == 2);
+    assert(a.owns(p));
+
+    a.reset();
+    assert(a.block_count() == 1);
+  }
+
+  static void test_full_reservation_chains_small_blocks()
+  {
+    // The first chained block grows from min_block_size, not from the
+    // 64 MiB reservation.
+    arena::Arena a(0, arena::Options{.growth_factor = 2.0, .min_block_size = 64 * KiB, .reserve_bytes = 64 * MiB});
+    (void)a.allocate(a.remaining() - rz, 1);
+    assert(a.committed() == a.capacity());
+
+    const std::size_t reservation = a.capacity();
+    void *p = a.allocate(1000);
+    assert(a.block_count() == 2);
+    assert(a.owns(p));
+    assert(a.capacity() - reservation == 128 * KiB);
+
+    // Later blocks grow from the chained ones.
+    (void)a.allocate(a.remaining() - rz, 1);
+    (void)a.allocate(1000);
+    assert(a.capacity() - reservation == 128 * KiB + 256 * KiB);
+  }
+
+  static void test_move_reserved()
+  {
+    arena::Arena a(0, arena::Options{.reserve_bytes = 16 * MiB});
+    void *p = a.allocate(1000);
+
+    arena::Arena b(std::move(a));
+    assert(b.reserved());
+    assert(b.owns(p));
+    assert(!a.reserved());
+    assert(a.capacity() == 0);
+
+    a = std::move(b);
+    assert(a.owns(p));
+  }
+}
+
+int main()
+{
+  test_reserve_commits_lazily();
+  test_initial_commit_and_limit();
+  test_decommit_threshold();
+  test_reserved_then_chained();
+  test_full_reservation_chains_small_blocks();
+  test_move_reserved();
+  return 0;
+}
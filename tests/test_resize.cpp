@@ -0,0 +1,124 @@
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  static void test_grow_last_in_place()
+  {
+    arena::Arena a(1024);
+    auto *p = static_cast<char *>(a.allocate(16, 1));
+    std::memcpy(p, "0123456789abcdef", 16);
+
+    const bool grown = a.try_resize(p, 16, 100);
+    assert(grown);
+    assert(a.used() == 100 + rz);
+    assert(std::memcmp(p, "0123456789abcdef", 16) == 0);
+
+    const bool shrunk = a.try_resize(p, 100, 40);
+    assert(shrunk);
+    assert(a.used() == 40 + rz);
+
+    // Does not fit the buffer: left unchanged.
+    assert(!a.try_resize(p, 40, 2048));
+    assert(a.used() == 40 + rz);
+  }
+
+  static void test_only_top_allocation()
+  {
+    arena::Arena a(1024);
+    void *p = a.allocate(32, 1);
+    void *q = a.allocate(32, 1);
+    assert(!a.try_resize(p, 32, 64));
+    const bool grown = a.try_resize(q, 32, 64);
+    assert(grown);
+    assert(a.used() == 96 + 2 * rz);
+    assert(!a.try_resize(nullptr, 0, 8));
+  }
+
+  static void test_release_top()
+  {
+    arena::Arena a(1024);
+    (void)a.allocate(10, 1);
+    void *p = a.allocate(50, 1);
+    const bool released = a.try_resize(p, 50, 0);
+    assert(released);
+    assert(a.used() == 10 + rz);
+  }
+
+  static void test_reallocate_fallback_copies()
+  {
+    arena::Arena a(4096);
+    auto *p = static_cast<int *>(a.allocate(4 * sizeof(int), alignof(int)));
+    for (int i = 0; i < 4; ++i)
+      p[i] = i;
+    (void)a.allocate(8); // p is no longer on top
+
+    auto *q = static_cast<int *>(a.reallocate(p, 4 * sizeof(int), 8 * sizeof(int), alignof(int)));
+    assert(q != p);
+    for (int i = 0; i < 4; ++i)
+      assert(q[i] == i);
+
+    // q is on top again, so the next growth is in place.
+    const std::size_t used = a.used();
+    void *grown = a.reallocate(q, 8 * sizeof(int), 16 * sizeof(int), alignof(int));
+    assert(grown == q);
+    assert(a.used() == used + 8 * sizeof(int));
+
+    // Shrinking never moves.
+    void *shrunk = a.reallocate(p, 4 * sizeof(int), sizeof(int), alignof(int));
+    assert(shrunk == p);
+  }
+
+  static void test_amortized_append()
+  {
+    arena::Arena a(1 << 20);
+    std::size_t cap = 16;
+    auto *buf = static_cast<std::uint8_t *>(a.allocate(cap, 1));
+    std::uint8_t *const first = buf;
+    for (std::size_t n = 0; n < 100000; ++n)
+    {
+      if (n == cap)
+      {
+        buf = static_cast<std::uint8_t *>(a.reallocate(buf, cap, cap * 2, 1));
+        cap *= 2;
+      }
+      buf[n] = static_cast<std::uint8_t>(n);
+    }
+    assert(buf == first); // never copied
+    assert(a.used() == cap + rz);
+  }
+
+  static void test_growable_and_reserved()
+  {
+    arena::Arena g(64, arena::Options{.growth_factor = 2.0});
+    void *p = g.allocate(48, 1);
+    auto *q = static_cast<char *>(g.reallocate(p, 48, 1000, 1));
+    assert(q != p);
+    assert(g.owns(q + 999));
+    assert(g.block_count() == 2);
+
+    arena::Arena r(0, arena::Options{.reserve_bytes = 64 << 20});
+    auto *b = static_cast<char *>(r.allocate(100, 1));
+    const bool grown = r.try_resize(b, 100, 8 << 20);
+    assert(grown);
+    if (grown)
+      b[(8 << 20) - 1] = 1;
+    assert(r.committed() >= (8u << 20));
+  }
+}
+
+int main()
+{
+  test_grow_last_in_place();
+  test_only_top_allocation();
+  test_release_top();
+  test_reallocate_fallback_copies();
+  test_amortized_append();
+  test_growable_and_reserved();
+  return 0;
+}
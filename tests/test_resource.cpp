@@ -0,0 +1,80 @@
+#include <arena/resource.hpp>
+
+#include <cassert>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+  static void test_pmr_containers()
+  {
+    arena::Arena a(1 << 20);
+    arena::Resource res(a);
+
+    std::pmr::vector<int> v(&res);
+    for (int i = 0; i < 1000; ++i)
+      v.push_back(i);
+    assert(a.owns(v.data()));
+    assert(v[999] == 999);
+
+    std::pmr::string s("a string long enough to defeat the small string buffer", &res);
+    assert(a.owns(s.data()));
+
+    std::pmr::unordered_map<int, std::pmr::string> m(&res);
+    m.emplace(1, "one");
+    m.emplace(2, "two");
+    assert(m.at(2) == "two");
+    assert(a.owns(&*m.find(1)));
+
+    assert(a.used() > 1000 * sizeof(int));
+  }
+
+  static void test_scope_frees_container_graph()
+  {
+    arena::Arena a(1 << 16);
+    arena::Resource res(a);
+
+    const std::size_t before = a.used();
+    {
+      arena::Arena::Scope scope(a);
+      std::pmr::vector<std::pmr::string> names(&res);
+      names.emplace_back("alpha");
+      names.emplace_back("beta");
+      assert(names[1] == "beta");
+    }
+    assert(a.used() == before);
+  }
+
+  static void test_equality_and_exhaustion()
+  {
+    arena::Arena a(64);
+    arena::Arena b(64);
+    arena::Resource r1(a), r2(a), r3(b);
+
+    assert(r1 == r2);
+    assert(r1 != r3);
+    assert(*std::pmr::new_delete_resource() != r1);
+    assert(&r1.arena() == &a);
+
+    bool threw = false;
+    try
+    {
+      (void)r1.allocate(1024);
+    }
+    catch (const std::bad_alloc &)
+    {
+      threw = true;
+    }
+    assert(threw);
+  }
+}
+
+int main()
+{
+  test_pmr_containers();
+  test_scope_frees_container_graph();
+  test_equality_and_exhaustion();
+  return 0;
+}
@@ -0,0 +1,180 @@
+#include <arena/size_class.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  static_assert(arena::SizeClassAllocator::class_of(1, 1) == 0);
+  static_assert(arena::SizeClassAllocator::class_of(8, 8) == 0);
+  static_assert(arena::SizeClassAllocator::class_of(9, 8) == 1);
+  static_assert(arena::SizeClassAllocator::class_of(8) == 1); // max_align_t rounds up to 16
+  static_assert(arena::SizeClassAllocator::class_of(200) == 5);
+  static_assert(arena::SizeClassAllocator::class_of(4096) == 9);
+  static_assert(arena::SizeClassAllocator::class_of(4097) == arena::SizeClassAllocator::class_count);
+  static_assert(arena::SizeClassAllocator::class_of(16, 128) == arena::SizeClassAllocator::class_count);
+
+  static void test_classes_and_alignment()
+  {
+    arena::Arena a(1 << 20);
+    arena::SizeClassAllocator slab(a, 4096);
+
+    for (std::size_t size : {1u, 7u, 8u, 24u, 100u, 513u, 4096u})
+    {
+      void *p = slab.allocate(size, 8);
+      assert(slab.owns(p));
+      const std::size_t c = arena::SizeClassAllocator::class_of(size, 8);
+      const std::size_t cs = arena::SizeClassAllocator::class_size(c);
+      assert(cs >= size);
+      assert(reinterpret_cast<std::uintptr_t>(p) % (cs < 64 ? cs : 64) == 0);
+      std::memset(p, 0xab, size);
+      assert(slab.stats(c).live == 1);
+      slab.deallocate(p, size, 8);
+      assert(slab.stats(c).live == 0);
+      assert(slab.stats(c).free_slots == 1);
+    }
+    assert(slab.live_bytes() == 0);
+  }
+
+  static void test_free_slots_are_reused()
+  {
+    arena::Arena a(1 << 20);
+    arena::SizeClassAllocator slab(a);
+
+    void *p = slab.allocate(48);
+    void *q = slab.allocate(40);
+    slab.deallocate(p, 48);
+
+    // Same class (64): the freed slot comes back first.
+    void *r = slab.allocate(60);
+    assert(r == p);
+    assert(slab.stats(3).live == 2);
+    assert(slab.live_bytes() == 128);
+
+    const std::size_t used = a.used();
+    slab.deallocate(r, 60);
+    slab.deallocate(q, 40);
+    for (int i = 0; i < 100; ++i)
+      slab.deallocate(slab.allocate(64), 64);
+    assert(a.used() == used);
+  }
+
+  static void test_mixed_lifetimes()
+  {
+    arena::Arena a(4 << 20);
+    arena::SizeClassAllocator slab(a, 16 * 1024);
+
+    std::vector<std::pair<void *, std::size_t>> live;
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+      const std::size_t size = 8 + (i * 37) % 2000;
+      live.emplace_back(slab.allocate(size), size);
+      if (i % 3 == 0)
+      {
+        auto [p, n] = live[i / 2];
+        if (p)
+        {
+          slab.deallocate(p, n);
+          live[i / 2].first = nullptr;
+        }
+      }
+    }
+
+    std::size_t total = 0;
+    for (const auto &s : slab.stats())
+    {
+      assert(s.live + s.free_slots <= s.capacity);
+      total += s.live;
+    }
+    std::size_t expected = 0;
+    for (const auto &[p, n] : live)
+      expected += p != nullptr;
+    assert(total == expected);
+
+    for (const auto &[p, n] : live)
+      slab.deallocate(p, n);
+    assert(slab.live_bytes() == 0);
+  }
+
+  static void test_large_and_overaligned_use_the_arena()
+  {
+    arena::Arena a(1 << 20);
+    arena::SizeClassAllocator slab(a);
+
+    void *big = slab.allocate(10000);
+    assert(!slab.owns(big) && a.owns(big));
+    slab.deallocate(big, 10000); // most recent allocation: reclaimed
+    assert(a.used() == 0);
+
+    void *wide = slab.allocate(32, 256);
+    assert(reinterpret_cast<std::uintptr_t>(wide) % 256 == 0);
+    assert(!slab.owns(wide));
+  }
+
+  struct Throws
+  {
+    explicit Throws(bool fail)
+    {
+      if (fail)
+        throw std::runtime_error("ctor");
+    }
+  };
+
+  static void test_make_destroy()
+  {
+    arena::Arena a(1 << 16);
+    arena::SizeClassAllocator slab(a, 4096);
+
+    auto *v = slab.make<std::uint64_t>(42u);
+    assert(*v == 42);
+    slab.destroy(v);
+    assert(slab.live_bytes() == 0);
+
+    bool caught = false;
+    try
+    {
+      (void)slab.make<Throws>(true);
+    }
+    catch (const std::runtime_error &)
+    {
+      caught = true;
+    }
+    assert(caught);
+    assert(slab.live_bytes() == 0);
+  }
+
+  static void test_exhaustion()
+  {
+    arena::Arena a(256);
+    arena::SizeClassAllocator slab(a);
+    assert(slab.try_allocate(4096) == nullptr);
+    assert(slab.try_allocate(16, 3) == nullptr);
+
+    bool thrown = false;
+    try
+    {
+      (void)slab.allocate(4096);
+    }
+    catch (const std::bad_alloc &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+}
+
+int main()
+{
+  test_classes_and_alignment();
+  test_free_slots_are_reused();
+  test_mixed_lifetimes();
+  test_large_and_overaligned_use_the_arena();
+  test_make_destroy();
+  test_exhaustion();
+  return 0;
+}
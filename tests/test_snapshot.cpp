@@ -0,0 +1,177 @@
+#include <arena/snapshot.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <memory_resource>
+#include <utility>
+
+namespace
+{
+  constexpr const char *snapshot_path = "arena_snapshot_test.bin";
+
+  struct Node
+  {
+    int value = 0;
+    arena::RelPtr<const char> name;
+    arena::RelPtr<Node> next;
+  };
+
+  struct List
+  {
+    int count = 0;
+    arena::RelPtr<Node> head;
+  };
+
+  static const char *copy_name(arena::Arena &a, const char *s)
+  {
+    const std::size_t n = std::strlen(s) + 1;
+    char *p = a.make_array<char>(n);
+    std::memcpy(p, s, n);
+    return p;
+  }
+
+  static void test_rel_ptr_basics()
+  {
+    int values[2] = {1, 2};
+    arena::RelPtr<int> p;
+    assert(!p && p == nullptr && p.get() == nullptr);
+
+    p = &values[1];
+    assert(p && *p == 2 && p.get() == &values[1]);
+
+    // A copy points at the same object, not at the same distance.
+    arena::RelPtr<int> q = p;
+    assert(q.get() == &values[1]);
+    assert(q == p);
+
+    p = nullptr;
+    assert(p.offset() == 0);
+  }
+
+  static void test_round_trip()
+  {
+    arena::Arena a(4096);
+    List *list = a.make<List>();
+
+    const char *names[] = {"alpha", "beta", "gamma"};
+    Node *prev = nullptr;
+    for (int i = 0; i < 3; ++i)
+    {
+      Node *n = a.make<Node>();
+      n->value = i * 10;
+      n->name = copy_name(a, names[i]);
+      if (prev)
+        prev->next = n;
+      else
+        list->head = n;
+      prev = n;
+      ++list->count;
+    }
+
+    assert(a.contents().size() == a.used());
+    const bool saved = arena::save_snapshot(a, snapshot_path, list);
+    assert(saved);
+
+    arena::MappedSnapshot snap = arena::MappedSnapshot::open(snapshot_path);
+    assert(snap);
+    assert(snap.size() == a.used());
+    assert(reinterpret_cast<std::uintptr_t>(snap.data()) % 64 == 0);
+    assert(snap.alignment() >= alignof(Node));
+
+    const List *loaded = snap.root<List>();
+    assert(loaded && snap.owns(loaded));
+    assert(static_cast<const void *>(loaded) != list);
+    assert(loaded->count == 3);
+
+    int i = 0;
+    for (const Node *n = loaded->head.get(); n; n = n->next.get(), ++i)
+    {
+      assert(snap.owns(n));
+      assert(n->value == i * 10);
+      assert(std::strcmp(n->name.get(), names[i]) == 0);
+    }
+    assert(i == 3);
+
+    // Offsets in the arena are offsets in the image.
+    const Node *first = loaded->head.get();
+    const auto offset = static_cast<std::size_t>(reinterpret_cast<const std::byte *>(first) - snap.data());
+    assert(snap.at<Node>(offset) == first);
+    assert(snap.at<Node>(snap.size()) == nullptr);
+  }
+
+  static void test_move_and_close()
+  {
+    arena::Arena a(256);
+    int *v = a.make<int>(42);
+    const bool saved = arena::save_snapshot(a, snapshot_path, v);
+    assert(saved);
+
+    arena::MappedSnapshot s1 = arena::MappedSnapshot::open(snapshot_path);
+    arena::MappedSnapshot s2 = std::move(s1);
+    assert(!s1 && s2);
+    assert(*s2.root<int>() == 42);
+
+    s2.close();
+    assert(!s2 && s2.root<int>() == nullptr);
+  }
+
+  static void test_rejects_invalid()
+  {
+    assert(!arena::MappedSnapshot::open("arena_snapshot_missing.bin"));
+
+    std::FILE *f = std::fopen(snapshot_path, "wb");
+    assert(f);
+    const char junk[100] = "not a snapshot";
+    const std::size_t written = std::fwrite(junk, sizeof(junk), 1, f);
+    assert(written == 1);
+    std::fclose(f);
+    assert(!arena::MappedSnapshot::open(snapshot_path));
+
+    // Chained blocks are not contiguous and cannot be saved.
+    arena::Arena grown(64, arena::Options{.growth_factor = 2.0});
+    (void)grown.allocate(256, 8);
+    assert(grown.contents().empty());
+    assert(!arena::save_snapshot(grown, snapshot_path));
+
+    // Neither are overflow allocations, which live outside the buffer.
+    arena::Arena spilled(64, arena::Options{.overflow = std::pmr::new_delete_resource()});
+    (void)spilled.allocate(16);
+    (void)spilled.allocate(256);
+    assert(spilled.overflow_bytes() == 256);
+    assert(!arena::save_snapshot(spilled, snapshot_path));
+    spilled.reset();
+    const bool saved = arena::save_snapshot(spilled, snapshot_path);
+    assert(saved);
+
+    // The root must live in the saved arena.
+    arena::Arena a(64);
+    int outside = 0;
+    assert(!arena::save_snapshot(a, snapshot_path, &outside));
+  }
+
+  static void test_no_root()
+  {
+    arena::Arena a(128);
+    (void)a.make<int>(7);
+    const bool saved = arena::save_snapshot(a, snapshot_path);
+    assert(saved);
+
+    arena::MappedSnapshot snap = arena::MappedSnapshot::open(snapshot_path);
+    assert(snap);
+    assert(snap.root<int>() == nullptr);
+    assert(*snap.at<int>(0) == 7);
+  }
+}
+
+int main()
+{
+  test_rel_ptr_basics();
+  test_round_trip();
+  test_move_and_close();
+  test_rejects_invalid();
+  test_no_root();
+
+  std::remove(snapshot_path);
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+
+static_assert(arena::Arena::stats_enabled, "test_stats must be built with ARENA_ENABLE_STATS=1");
+
+namespace
+{
+  constexpr std::size_t rz = arena::Arena::redzone_size;
+
+  static void test_counters()
+  {
+    arena::Arena a(1024);
+
+    (void)a.allocate(1, 1);
+    (void)a.allocate(8, 8); // 7 bytes of padding
+    (void)a.make<std::uint32_t>(1u);
+
+    arena::Stats s = a.stats();
+    assert(s.allocations == 3);
+    assert(s.padding_bytes == 7);
+    assert(s.peak_used == a.used());
+    assert(s.failed_allocations == 0);
+    assert(s.blocks == 1);
+
+    assert(a.try_allocate(4096) == nullptr);
+    assert(a.try_allocate(8, 3) == nullptr);
+    assert(a.stats().failed_allocations == 2);
+  }
+
+  static void test_peak_survives_reset_and_rewind()
+  {
+    arena::Arena a(4096);
+    {
+      arena::Arena::Scope scope(a);
+      (void)a.allocate(1000, 1);
+    }
+    (void)a.allocate(100, 1);
+    a.reset();
+
+    arena::Stats s = a.stats();
+    assert(s.peak_used == 1000 + rz);
+    assert(s.rewinds == 1);
+    assert(s.resets == 1);
+
+    a.reset_stats();
+    assert(a.stats().peak_used == 0);
+    assert(a.stats().allocations == 0);
+  }
+
+  static void test_resize_updates_peak()
+  {
+    arena::Arena a(4096);
+    void *p = a.allocate(16, 1);
+    assert(a.try_resize(p, 16, 512));
+    assert(a.stats().peak_used == 512 + rz);
+    assert(a.stats().allocations == 1);
+  }
+
+  static void test_growable_blocks()
+  {
+    arena::Arena a(256, arena::Options{.growth_factor = 2.0, .min_block_size = 256});
+    for (int i = 0; i < 100; ++i)
+      (void)a.allocate(64, 8);
+
+    arena::Stats s = a.stats();
+    assert(s.allocations == 100);
+    assert(s.blocks == a.block_count());
+    assert(s.blocks > 1);
+    assert(s.peak_used == a.used());
+  }
+
+  static void test_aggregate()
+  {
+    arena::Arena a(1024);
+    arena::Arena b(1024);
+    (void)a.allocate(100, 1);
+    (void)b.allocate(200, 1);
+    b.reset();
+
+    arena::Stats total;
+    total += a.stats();
+    total += b.stats();
+    assert(total.allocations == 2);
+    assert(total.peak_used == 300 + 2 * rz);
+    assert(total.resets == 1);
+    assert(total.blocks == 2);
+    assert((a.stats() + b.stats()).peak_used == 300 + 2 * rz);
+  }
+}
+
+int main()
+{
+  test_counters();
+  test_peak_survives_reset_and_rewind();
+  test_resize_updates_peak();
+  test_growable_blocks();
+  test_aggregate();
+  return 0;
+}
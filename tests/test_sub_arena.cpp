@@ -0,0 +1,126 @@
+#include <arena/arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace
+{
+  static void test_child_on_top_gives_bytes_back()
+  {
+    arena::Arena parent(1 << 16);
+    (void)parent.allocate(96);
+    const std::size_t before = parent.used();
+    {
+      arena::SubArena request = parent.child(4096);
+      assert(parent.used() >= before + 4096);
+      assert(request->capacity() == 4096);
+
+      int *x = request->make<int>(7);
+      assert(parent.owns(x));
+      assert(request->owns(x));
+    }
+    assert(parent.used() == before);
+  }
+
+  static void test_child_not_on_top_keeps_bytes()
+  {
+    arena::Arena parent(1 << 16);
+    auto child = std::make_unique<arena::SubArena>(parent, 1024);
+    (void)parent.allocate(64);
+    const std::size_t used = parent.used();
+    child.reset();
+    assert(parent.used() == used);
+
+    parent.reset();
+    assert(parent.used() == 0);
+  }
+
+  static void test_independent_marks_and_reset()
+  {
+    arena::Arena parent(1 << 16);
+    arena::SubArena child = parent.child(2048);
+    const std::size_t parent_used = parent.used();
+
+    {
+      arena::Arena::Scope scope(child);
+      (void)child->allocate(512);
+      assert(child->used() >= 512);
+    }
+    assert(child->used() == 0);
+
+    (void)child->allocate(100);
+    child->reset();
+    assert(child->used() == 0);
+    assert(parent.used() == parent_used);
+
+    assert(child->try_allocate(4096) == nullptr);
+  }
+
+  static void test_nesting()
+  {
+    arena::Arena connection(1 << 16);
+    {
+      arena::SubArena request = connection.child(8192);
+      {
+        arena::SubArena scratch = request->child(1024);
+        auto *buf = static_cast<char *>(scratch->allocate(1000, 1));
+        assert(request->owns(buf) && connection.owns(buf));
+        assert(request->used() >= 1024);
+      }
+      assert(request->used() == 0);
+    }
+    assert(connection.used() == 0);
+  }
+
+  static void test_destructors_and_move()
+  {
+    static int destroyed = 0;
+    struct Tracked
+    {
+      std::string s = "long enough to live on the heap, not in SSO";
+      ~Tracked() { ++destroyed; }
+    };
+
+    arena::Arena parent(1 << 16);
+    arena::SubArena a = parent.child(4096, arena::Options{.track_destructors = true});
+    (void)a->make<Tracked>();
+
+    arena::SubArena b = std::move(a);
+    assert(a.parent() == nullptr);
+    assert(b.parent() == &parent);
+
+    b.release();
+    assert(destroyed == 1);
+    assert(parent.used() == 0);
+    b.release();
+  }
+
+  static void test_exhausted_parent_throws()
+  {
+    arena::Arena parent(256);
+    bool threw = false;
+    try
+    {
+      (void)parent.child(1024);
+    }
+    catch (const std::bad_alloc &)
+    {
+      threw = true;
+    }
+    assert(threw);
+  }
+}
+
+int main()
+{
+  test_child_on_top_gives_bytes_back();
+  test_child_not_on_top_keeps_bytes();
+  test_independent_marks_and_reset();
+  test_nesting();
+  test_destructors_and_move();
+  test_exhausted_parent_throws();
+  return 0;
+}
@@ -0,0 +1,162 @@
+#include <arena/block_pool.hpp>
+#include <arena/thread_scratch.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  // Four of these fit a 4 KiB pool block, redzones included.
+  constexpr std::size_t kChunk = 1000 - arena::Arena::redzone_size;
+
+  /// @brief Counts the allocations reaching the system allocator.
+  class CountingResource final : public std::pmr::memory_resource
+  {
+  public:
+    std::atomic<int> allocations{0};
+    std::atomic<int> live{0};
+
+  private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      ++allocations;
+      ++live;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+    {
+      --live;
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+      return this == &other;
+    }
+  };
+
+  static arena::Options pooled(arena::BlockPool &pool)
+  {
+    return arena::Options{
+        .growth_factor = 1.0,
+        .min_block_size = pool.block_size() - arena::Arena::block_overhead(),
+        .cache_blocks = false,
+        .upstream = &pool,
+    };
+  }
+
+  static void test_arena_uses_upstream()
+  {
+    CountingResource counting;
+    {
+      arena::Arena a(0, arena::Options{.growth_factor = 2.0, .upstream = &counting});
+      (void)a.allocate(100);
+      (void)a.allocate(10000);
+      assert(counting.allocations == 2);
+      assert(counting.live == 2);
+    }
+    assert(counting.live == 0);
+  }
+
+  static void test_pool_recycles_blocks()
+  {
+    CountingResource counting;
+    {
+      arena::BlockPool pool(4096, &counting);
+      {
+        arena::Arena a(0, pooled(pool));
+        for (int i = 0; i < 10; ++i)
+          (void)a.allocate(kChunk);
+        assert(a.block_count() == 4); // 3 chained + the empty initial buffer
+        assert(counting.allocations == 3);
+      }
+      assert(pool.free_blocks() == 3);
+
+      {
+        arena::Arena b(0, pooled(pool));
+        for (int i = 0; i < 10; ++i)
+          (void)b.allocate(kChunk);
+        assert(counting.allocations == 3); // all served from the free list
+        assert(pool.free_blocks() == 0);
+
+        // Oversized blocks bypass the pool.
+        (void)b.allocate(100000);
+        assert(counting.allocations == 4);
+      }
+      assert(pool.free_blocks() == 3);
+    }
+    assert(counting.live == 0);
+  }
+
+  static void test_pool_across_threads()
+  {
+    CountingResource counting;
+    {
+      arena::BlockPool pool(4096, &counting);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < 8; ++t)
+      {
+        threads.emplace_back([&pool]
+                             {
+          arena::Arena a(0, pooled(pool));
+          for (int round = 0; round < 200; ++round)
+          {
+            arena::Arena::Scope scope(a);
+            for (int i = 0; i < 5; ++i)
+            {
+              auto *p = static_cast<char *>(a.allocate(2000));
+              std::memset(p, round, 2000);
+            }
+          }
+          a.trim(); });
+      }
+      for (auto &th : threads)
+        th.join();
+
+      // Far fewer system allocations than blocks handed out.
+      assert(counting.allocations <= 8 * 5);
+      assert(static_cast<int>(pool.free_blocks()) == counting.live);
+    }
+    assert(counting.live == 0);
+  }
+
+  static void test_thread_scratch()
+  {
+    arena::Arena &s = arena::thread_scratch();
+    assert(&s == &arena::thread_scratch());
+    assert(s.growable());
+
+    {
+      arena::Arena::Scope scope(arena::thread_scratch());
+      int *xs = s.make_array<int>(1000);
+      xs[999] = 1;
+      assert(s.owns(xs));
+    }
+    assert(s.used() == 0);
+
+    arena::Arena *other = nullptr;
+    std::thread([&other]
+                { other = &arena::thread_scratch(); })
+        .join();
+    assert(other != &s);
+
+    const std::size_t before = arena::BlockPool::global().free_blocks();
+    arena::trim_thread_scratch();
+    assert(arena::BlockPool::global().free_blocks() >= before);
+  }
+}
+
+int main()
+{
+  test_arena_uses_upstream();
+  test_pool_recycles_blocks();
+  test_pool_across_threads();
+  test_thread_scratch();
+  return 0;
+}
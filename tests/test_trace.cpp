@@ -0,0 +1,238 @@
+#include <arena/arena.hpp>
+#include <arena/trace.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  static_assert(ARENA_ENABLE_TRACING == 1);
+
+  static void test_records_call_sites()
+  {
+    arena::TraceRing &ring = arena::TraceRing::global();
+    ring.clear();
+
+    arena::Arena a(4096);
+    (void)a.allocate<1>(3);
+    const std::uint32_t line_a = __LINE__ + 1;
+    (void)a.allocate(16, 16);
+    const std::uint32_t line_b = __LINE__ + 1;
+    (void)a.make_array<std::uint32_t>(4);
+
+    const std::vector<arena::TraceEvent> events = ring.events(&a);
+    assert(events.size() == 3);
+
+    assert(events[1].line == line_a);
+    assert(events[1].size == 16);
+    // 3 bytes (plus any poisoning redzone), then 16 aligned to 16.
+    const std::size_t first = 3 + arena::Arena::redzone_size;
+    const std::size_t aligned = (first + 15) & ~std::size_t{15};
+    assert(events[1].padding == aligned - first);
+    assert(events[1].used == aligned + 16 + arena::Arena::redzone_size);
+    assert(std::string(events[1].file).find("test_trace.cpp") != std::string::npos);
+
+    assert(events[2].line == line_b);
+    assert(events[2].size == 16);
+    assert(events[2].used == a.used());
+    assert(events[2].time_ns >= events[1].time_ns);
+    assert(events[2].thread == events[0].thread && events[0].thread != 0);
+
+    // Failed allocations are not recorded.
+    assert(a.try_allocate(1 << 20) == nullptr);
+    assert(ring.events(&a).size() == 3);
+
+    // Padding is also reported when the allocation commits more of a
+    // reservation (the slow path). The reservation is page-aligned.
+    ring.clear();
+    arena::Arena r(0, arena::Options{.reserve_bytes = 1 << 20});
+    (void)r.allocate<1>(3);
+    (void)r.allocate(1 << 17, 64);
+    const std::vector<arena::TraceEvent> slow = ring.events(&r);
+    assert(slow.size() == 2);
+    assert(slow[0].padding == 0);
+    assert(slow[1].padding == ((first + 63) & ~std::size_t{63}) - first);
+    assert(slow[1].used == r.used());
+  }
+
+  struct Node
+  {
+    int key;
+    explicit Node(int k) : key(k) {}
+    ~Node() {}
+  };
+
+  static void test_records_make_call_sites()
+  {
+    arena::TraceRing &ring = arena::TraceRing::global();
+    ring.clear();
+
+    arena::Arena a(4096);
+    const std::uint32_t line_at = __LINE__ + 1;
+    Node *n = a.make_at<Node>(arena::CallSite::current(), 3);
+    assert(n->key == 3);
+    (void)a.make<Node>(4);
+
+    const std::vector<arena::TraceEvent> events = ring.events(&a);
+    assert(events.size() == 2);
+    assert(events[0].line == line_at);
+    assert(events[0].size == sizeof(Node));
+    assert(std::string(events[0].file).find("test_trace.cpp") != std::string::npos);
+
+    // make() records its own location, with T in the function name.
+    assert(std::string(events[1].file).find("arena.hpp") != std::string::npos);
+    assert(std::string(events[1].function).find("make") != std::string::npos);
+    assert(events[1].size == sizeof(Node));
+
+    // The destructor record is attributed to the same call site.
+    ring.clear();
+    arena::Arena tracked(4096, arena::Options{.track_destructors = true});
+    const std::uint32_t line_tracked = __LINE__ + 1;
+    (void)tracked.make_at<Node>(arena::CallSite::current(), 5);
+    const std::vector<arena::TraceEvent> tracked_events = ring.events(&tracked);
+    assert(tracked_events.size() == 2);
+    assert(tracked_events[0].line == line_tracked && tracked_events[1].line == line_tracked);
+    assert(tracked_events[1].size == sizeof(Node));
+    tracked.reset();
+  }
+
+  static void test_filters_by_arena()
+  {
+    arena::TraceRing &ring = arena::TraceRing::global();
+    ring.clear();
+
+    arena::Arena a(1024);
+    arena::Arena b(1024);
+    (void)a.allocate(8);
+    (void)b.allocate(8);
+    (void)b.allocate(8);
+
+    assert(ring.events().size() == 3);
+    assert(ring.events(&a).size() == 1);
+    assert(ring.events(&b).size() == 2);
+  }
+
+  static void test_ring_overwrites_oldest()
+  {
+    arena::TraceRing ring(5);
+    assert(ring.capacity() == 8);
+
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+      arena::TraceEvent e;
+      e.size = i;
+      ring.record(e);
+    }
+    assert(ring.recorded() == 20);
+    assert(ring.dropped() == 12);
+
+    const std::vector<arena::TraceEvent> events = ring.events();
+    assert(events.size() == 8);
+    assert(events.front().size == 12 && events.back().size == 19);
+  }
+
+  static void test_concurrent_record()
+  {
+    arena::TraceRing ring(1 << 12);
+    constexpr std::size_t kThreads = 4;
+    constexpr std::size_t kPerThread = 500;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+      threads.emplace_back(
+          [&ring]
+          {
+            for (std::size_t i = 0; i < kPerThread; ++i)
+            {
+              arena::TraceEvent e;
+              e.size = 1;
+              ring.record(e);
+            }
+          });
+    for (auto &t : threads)
+      t.join();
+
+    const std::vector<arena::TraceEvent> events = ring.events();
+    assert(events.size() == kThreads * kPerThread);
+    std::size_t total = 0;
+    for (const auto &e : events)
+      total += e.size;
+    assert(total == kThreads * kPerThread);
+  }
+
+  static void test_folded_output()
+  {
+    arena::TraceRing ring(16);
+    arena::TraceEvent e;
+    e.file = "src/parse.cpp";
+    e.function = "void parse(std::string_view)";
+    e.line = 42;
+    e.size = 100;
+    e.padding = 4;
+    ring.record(e);
+    ring.record(e);
+    e.line = 7;
+    e.size = 8;
+    e.padding = 0;
+    ring.record(e);
+
+    std::ostringstream out;
+    arena::write_folded(out, ring);
+    assert(out.str() == "void_parse(std::string_view);src/parse.cpp:7 8\n"
+                        "void_parse(std::string_view);src/parse.cpp:42 208\n");
+  }
+
+  static void test_chrome_trace_output()
+  {
+    arena::TraceRing ring(16);
+    arena::TraceEvent e;
+    e.file = "a\"b.cpp";
+    e.function = "f";
+    e.line = 3;
+    e.size = 24;
+    e.used = 24;
+    ring.record(e);
+
+    std::ostringstream out;
+    arena::write_chrome_trace(out, ring);
+    const std::string json = out.str();
+    assert(json.rfind("{\"traceEvents\":[", 0) == 0);
+    assert(json.find("\"name\":\"a\\\"b.cpp:3\"") != std::string::npos);
+    assert(json.find("\"size\":24") != std::string::npos);
+    assert(json.find("\"ph\":\"C\"") != std::string::npos);
+    assert(json.find("]}") != std::string::npos);
+
+    // Ring order is not time order across threads: timestamps stay >= 0.
+    arena::TraceRing skewed(4);
+    e.time_ns = 2000;
+    skewed.record(e);
+    e.time_ns = 1000;
+    skewed.record(e);
+    std::ostringstream out2;
+    arena::write_chrome_trace(out2, skewed);
+    assert(out2.str().find("\"ts\":1,") != std::string::npos);
+    assert(out2.str().find("\"ts\":0,") != std::string::npos);
+    assert(out2.str().find("e+") == std::string::npos);
+
+    std::ostringstream empty;
+    arena::write_chrome_trace(empty, arena::TraceRing(4));
+    assert(empty.str() == "{\"traceEvents\":[\n]}\n");
+  }
+}
+
+int main()
+{
+  test_records_call_sites();
+  test_records_make_call_sites();
+  test_filters_by_arena();
+  test_ring_overwrites_oldest();
+  test_concurrent_record();
+  test_folded_output();
+  test_chrome_trace_output();
+  return 0;
+}